@@ -32,6 +32,17 @@
  * \author          Tilen MAJERLE <tilen@majerle.eu>
  */
 #include "regex.h"
+#if REGEX_CFG_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif /* defined(__SSSE3__) */
+#elif REGEX_CFG_SIMD && defined(__aarch64__)
+#include <arm_neon.h>
+#endif /* REGEX_CFG_SIMD */
+#if REGEX_CFG_PARALLEL_PTHREAD
+#include <pthread.h>
+#endif /* REGEX_CFG_PARALLEL_PTHREAD */
 
 /*
  * Regular expression library will match these examples:
@@ -62,14 +73,13 @@
  * /[abc]/g                         Match character if it is 'a', 'b' or 'c'
  * /[^abc]/g                        Match character if it is NOT 'a', 'b' or 'c'
  * /a(ab){1,2}c/g                   Match character 'a', followed by sequence "ab" between 1 or 2 times followed by character 'c' (Valid inputs: "aabc" or "aababc")
- *
- * Regular expression library will not work with these examples (behavior is undefined):
- *
+ * /\\d++a/g                        Match digits as many as possible, never given back, followed by 'a'. Also `*+`, `?+` and `{min,max}+`
  * /a(a|b|c(cd|ef))/g               Match character 'a', followed by either 'a', 'b' or ('c' followed by either 'cd' or 'ef')
  * /(ab|cd)+/g                      Match "ab" or "cd" strings 1 or more times
+ * /ab|cd/g                         Match literal "ab" or "cd", alternation outside of groups spans entire pattern between `^` and `$`
+ * /content-length/gi               Match literal "content-length" in any letter case, such as "Content-Length". Flags follow closing '/' in any order
  *
  * TODO:
- * - Implement unlimited groups /(ab(cd|ef(gdh))+/g
  * - Add option for + and * characters fo
  * - Implement recursive patterns (children of current)
  */
@@ -79,13 +89,37 @@
  */
 typedef regex_pattern_t p_t;
 
-#define RANGE_MAX                               (0x7FFF)
+#define RANGE_MAX                               (0xFFFFFFFFUL)  /*!< Maximal readings without limit */
+#define POSS_AUTO                               1       /*!< Repetitions are possessive, because giving them back never lets rest of pattern match */
+#define POSS_SYNTAX                             2       /*!< Repetitions are possessive by quantifier followed by `+` */
+#define GRP_NONE                                0xFFFF  /*!< Group index of internal group, which does not capture */
 
 /* List of internal functions */
-static uint8_t match_pattern(regex_t* r, const p_t* p, const char* str, uint8_t prev_result);
+static uint8_t match_class_char(const regex_t* r, const p_t* p, const char* str);
+static void compile_first_atom(const regex_t* r, regex_class_t* set, const p_t* p);
+static uint8_t compile_first_pattern(const regex_t* r, const p_t* p, regex_class_t* set);
 
 #define PTR_INC() do { p++, len = len > 0 ? len - 1 : 0; } while (0);
 
+#if defined(__GNUC__)
+#define REGEX_PREFETCH(x)       __builtin_prefetch(x)
+#else
+#define REGEX_PREFETCH(x)
+#endif /* defined(__GNUC__) */
+
+#if REGEX_CFG_DEBUG
+static regex_debug_fn debug_fn;                 /* User debug callback */
+#define REGEX_DEBUG(r, evt, p, s)   do { if (debug_fn != NULL) { debug_fn((r), (evt), (p), (s)); } } while (0)
+#else
+#define REGEX_DEBUG(r, evt, p, s)
+#endif /* REGEX_CFG_DEBUG */
+
+#if REGEX_CFG_STATS
+#define REGEX_STAT(ctx, field)      ((ctx)->stats.field++)
+#else
+#define REGEX_STAT(ctx, field)
+#endif /* REGEX_CFG_STATS */
+
 /**
  * List of special character (s, f, w) values
  */
@@ -97,71 +131,250 @@ static uint8_t match_pattern(regex_t* r, const p_t* p, const char* str, uint8_t
 #define IS_D_CHAR(x)            IS_DIGIT(x)
 #define IS_W_CHAR(x)            (((x) >= 'a' && (x) <= 'z') || ((x) >= 'A' && (x) <= 'Z') || ((x) >= '0' && (x) <= '9') || (x) == '_')
 #define IS_C_UPPER(x)           ((x) >= 'A' && (x) <= 'Z')
+#define IS_C_ALPHA(x)           (IS_C_UPPER(x) || ((x) >= 'a' && (x) <= 'z'))
+#define FOLD(x)                 (fold_table[(uint8_t)(x)])  /*!< Lowercase ASCII letter, other bytes are not changed */
+#define FOLD_OTHER(x)           ((char)(IS_C_ALPHA(x) ? (x) ^ 0x20 : (x)))  /*!< The other case of ASCII letter */
+#define IS_SEQUENCE(t)          ((t) == P_CHAR_SEQUENCE || (t) == P_CHAR_SEQUENCE_FOLD)
 #define CHAR_TO_NUM(x)          ((x) - '0')
-#define CAN_MATCH_MORE(p)       (!((p[1].type == P_EMPTY) || (p[1].type == P_CAPTURE_END && p[2].type == P_EMPTY)))
+#define CAN_MATCH_MORE(p)       (!((p[1].type == P_EMPTY) || (p[1].type == P_CAPTURE_END && !p[1].min && !p[1].max && p[2].type == P_EMPTY)))
+#define RANGE_MORE(p, cnt)      ((p)->max == RANGE_MAX || (cnt) < (p)->max) /*!< Entry may be repeated once more */
+#define CLASS_HAS(c, x)         ((c)->set[(uint8_t)(x) >> 3] & (1 << ((uint8_t)(x) & 0x07)))
+#define MODE_ANCHORED(ctx)      (((ctx)->mode & (REGEX_MODE_ANCHORED_START | REGEX_MODE_FULL_MATCH)) != 0)  /*!< Search mode allows match only at start position */
+#define IS_ONE_CHAR(p)          ((p)->type == P_DOT || (p)->type == P_CHAR || (p)->type == P_CHAR_CLASS || (p)->type == P_CHAR_CLASS_NOT)
+
+#define FOLD_ROW(x)             (x), (x) + 1, (x) + 2, (x) + 3, (x) + 4, (x) + 5, (x) + 6, (x) + 7, \
+                                (x) + 8, (x) + 9, (x) + 10, (x) + 11, (x) + 12, (x) + 13, (x) + 14, (x) + 15
+
+/**
+ * \brief           ASCII case fold table, uppercase letters are mapped to lowercase
+ * \note            Used by case-insensitive compare of sequences and required literal
+ */
+static const uint8_t fold_table[256] = {
+    FOLD_ROW(0x00), FOLD_ROW(0x10), FOLD_ROW(0x20), FOLD_ROW(0x30),
+    0x40, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
+    'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+    FOLD_ROW(0x60), FOLD_ROW(0x70), FOLD_ROW(0x80), FOLD_ROW(0x90), FOLD_ROW(0xA0), FOLD_ROW(0xB0),
+    FOLD_ROW(0xC0), FOLD_ROW(0xD0), FOLD_ROW(0xE0), FOLD_ROW(0xF0),
+};
+
+/**
+ * \brief           Compile character class of pattern to 256-bit membership set
+ *
+ * Class text is evaluated once for every possible input byte,
+ * so that matching later requires only single bit test.
+ * Identical classes (such as multiple \\d in pattern) share the same entry.
+ *
+ * \param[in]       p: Pointer to pattern with character class string set
+ * \param[in]       fold: Set to 1 to add the other case of every member letter, before negation
+ * \return          1 if compiled, 0 if there is no memory for new class
+ */
+static uint8_t
+compile_class(regex_t* r, p_t* p, uint8_t fold) {
+    regex_class_t c;
+    size_t i;
+    char ch, other;
+
+    memset(&c, 0x00, sizeof(c));
+    for (i = 0; i < 256; i++) {                 /* Test every possible input character */
+        ch = (char)i;
+        other = fold ? FOLD_OTHER(ch) : ch;
+        if ((match_class_char(r, p, &ch) || (other != ch && match_class_char(r, p, &other))) != (p->type == P_CHAR_CLASS_NOT)) {
+            c.set[i >> 3] |= 1 << (i & 0x07);   /* Negation is folded in */
+        }
+    }
+    for (i = 0; i < r->c_len; i++) {            /* Check for existing identical class */
+        if (!memcmp(&r->c[i], &c, sizeof(c))) {
+            break;
+        }
+    }
+    if (i == r->c_len) {                        /* Class does not exist yet */
+        if (r->c_len >= r->c_totlen) {          /* End of available classes? */
+            return 0;
+        }
+        memcpy(&r->c[r->c_len++], &c, sizeof(c));
+    }
+    p->cls = (uint16_t)i;                       /* Set class index */
+    return 1;
+}
+
+/**
+ * \brief           Parse decimal number of repetitions
+ * \param[in,out]   str: Pointer to first digit, set to first character after number
+ * \param[out]      num: Output for parsed number
+ * \return          1 on success, 0 if number is not below \ref RANGE_MAX
+ */
+static uint8_t
+parse_count(const char** str, uint32_t* num) {
+    const char* s = *str;
+
+    for (*num = 0; IS_DIGIT(*s); s++) {
+        if (*num > (RANGE_MAX - 1 - CHAR_TO_NUM(*s)) / 10) {
+            return 0;
+        }
+        *num = *num * 10 + CHAR_TO_NUM(*s);
+    }
+    *str = s;
+    return 1;
+}
+
+/**
+ * \brief           Get entry repeated by quantifier
+ * \note            Quantifier after group end repeats entire group
+ * \param[in]       i: Index of entry for quantifier character
+ * \return          Pointer to repeated entry, `NULL` if there is nothing to repeat
+ */
+static p_t*
+compile_quant(regex_t* r, size_t i) {
+    p_t* p = i > 0 ? &r->p[i - 1] : NULL;
+
+    if (p == NULL || p->type == P_CAPTURE_START || p->type == P_OR || p->type == P_BEGIN || p->type == P_END) {
+        return NULL;
+    }
+    return p;
+}
+
+/**
+ * \brief           Link groups and alternatives of compiled pattern with relative offsets
+ *
+ * Group start and each OR hold offset to group end in \ref regex_pattern_t.len
+ * and offset to next OR of the same group in \ref regex_pattern_t.alt.
+ * Group end holds offset back to group start.
+ * Engines jump with offsets instead of searching for matching entries.
+ *
+ * \param[in]       p: Pointer to first entry of pattern
+ * \param[out]      loops: Output for nesting depth of repeated groups
+ * \return          1 on success, 0 if groups are not balanced, OR is outside of group
+ *                      or groups are nested deeper than \ref REGEX_CFG_GROUP_DEPTH
+ */
+static uint8_t
+compile_links(p_t* p, size_t* loops) {
+    p_t* q, *a;
+    size_t depth = 0, loop = 0, d;
+
+    *loops = 0;
+    for (; p->type != P_EMPTY; p++) {
+        if (p->type == P_OR && !depth) {
+            return 0;
+        } else if (p->type == P_CAPTURE_END) {
+            if (!depth) {
+                return 0;
+            }
+            depth--;
+            loop -= p->min || p->max;
+        }
+        if (p->type != P_CAPTURE_START) {
+            continue;
+        }
+        if (++depth > REGEX_CFG_GROUP_DEPTH) {
+            return 0;
+        }
+        for (a = p, d = 0, q = p + 1; q->type != P_EMPTY; q++) {   /* Find group end and OR entries of this group */
+            if (q->type == P_CAPTURE_START) {
+                d++;
+            } else if (q->type == P_CAPTURE_END && !d--) {
+                break;
+            } else if (q->type == P_OR && !d) {
+                a->alt = (uint32_t)(q - a);
+                a = q;
+            }
+        }
+        if (q->type != P_CAPTURE_END || q->grp != p->grp) {
+            return 0;
+        }
+        a->alt = 0;
+        for (a = p;; a += a->alt) {
+            a->len = (uint32_t)(q - a);
+            if (!a->alt) {
+                break;
+            }
+        }
+        q->len = (uint32_t)(q - p);
+        if ((q->min || q->max) && ++loop > *loops) {
+            *loops = loop;
+        }
+    }
+    return 1;
+}
 
 /**
  * \brief           Compiles input pattern to library valid entries
+ * \note            Alternation outside of groups is enclosed in internal group, which does not capture
+ * \note            With case folding, letter is compiled to class of both cases
+ *                  and sequence with letters to \ref P_CHAR_SEQUENCE_FOLD, so matching does not fold classes
  * \param[in]       p: Pointer to input pattern
  * \param[in]       len: Length of pattern
+ * \param[in]       fold: Set to 1 to match letters in any case, by `i` flag
  * \return          1 if compiled, 0 otherwise
  */
 static uint8_t
-compile_pattern(regex_t* r, const char* p, size_t len) {
-    size_t i = 0;
+compile_pattern(regex_t* r, const char* p, size_t len, uint8_t fold) {
+    size_t i = 0, nest = 0, b, e;
     p_t* patterns = r->p;
+    p_t* quant = NULL, *last;                   /* Entry with repetitions set by previous character */
+    uint8_t alt = 0;                            /* Set when OR is outside of groups */
     while (len) {                               /* Process entire pattern char by char */
         if (i >= r->p_totlen) {                 /* End of available patterns? */
             return 0;                           /* Stop execution */
         }
         memset(&patterns[i], 0x00, sizeof(patterns[0]));
+        last = quant;
+        quant = NULL;
         switch (*p) {
             case '^': patterns[i].type = P_BEGIN; break;
             case '$': patterns[i].type = P_END; break;
             case '.': patterns[i].type = P_DOT; break;
             case '*':
-                if (i > 1 && (patterns[i - 1].type == P_CAPTURE_START || patterns[i - 1].type == P_CAPTURE_END)) {
-                    patterns[i - 2].min = 0;
-                    patterns[i - 2].max = RANGE_MAX;
-                    goto ignore;
-                } else if (i > 0) {
-                    patterns[i - 1].min = 0;
-                    patterns[i - 1].max = RANGE_MAX;
-                    goto ignore;
+                if ((quant = compile_quant(r, i)) == NULL) {
+                    return 0;                   /* Nothing to repeat */
                 }
-                break;
+                quant->min = 0;
+                quant->max = RANGE_MAX;
+                goto ignore;
             case '+':
-                if (i > 1 && (patterns[i - 1].type == P_CAPTURE_START || patterns[i - 1].type == P_CAPTURE_END)) {
-                    patterns[i - 2].min = 1;
-                    patterns[i - 2].max = RANGE_MAX;
-                    goto ignore;
-                } else if (i > 0) {
-                    patterns[i - 1].min = 1;
-                    patterns[i - 1].max = RANGE_MAX;
+                if (last != NULL) {             /* Quantifier followed by '+' never gives repetitions back */
+                    last->poss = POSS_SYNTAX;
                     goto ignore;
                 }
-                break;
+                if ((quant = compile_quant(r, i)) == NULL) {
+                    return 0;                   /* Nothing to repeat */
+                }
+                quant->min = 1;
+                quant->max = RANGE_MAX;
+                goto ignore;
             //case '?': patterns[i].type = P_QM; break;
             case '?':
-                if (i > 1 && (patterns[i - 1].type == P_CAPTURE_START || patterns[i - 1].type == P_CAPTURE_END)) {
-                    patterns[i - 2].min = 0;
-                    patterns[i - 2].max = 1;
-                    goto ignore;
-                } else if (i > 0) {
-                    patterns[i - 1].min = 0;
-                    patterns[i - 1].max = 1;
-                    goto ignore;
+                if ((quant = compile_quant(r, i)) == NULL) {
+                    return 0;                   /* Nothing to repeat */
                 }
+                quant->min = 0;
+                quant->max = 1;
+                goto ignore;
+            case '|':
+                patterns[i].type = P_OR;
+                alt |= !nest;
                 break;
-            case '|': patterns[i].type = P_OR; break;
             case '(':
-                //goto ignore;
+                if (r->g_len >= GRP_NONE) {     /* Index is reserved for internal group */
+                    return 0;
+                }
+                nest++;
                 patterns[i].type = P_CAPTURE_START; /* Start of capturing group */
+                patterns[i].grp = (uint16_t)r->g_len++; /* Groups are numbered in order of opening */
                 break;
-            case ')':
-                //goto ignore;
+            case ')': {
+                size_t j, depth = 0;
                 patterns[i].type = P_CAPTURE_END;   /* End of capturing group */
+                nest -= nest > 0;
+                for (j = i; j > 0; j--) {       /* Find last group start which is not closed yet */
+                    if (patterns[j - 1].type == P_CAPTURE_END) {
+                        depth++;
+                    } else if (patterns[j - 1].type == P_CAPTURE_START && !depth--) {
+                        patterns[i].grp = patterns[j - 1].grp;
+                        break;
+                    }
+                }
                 break;
+            }
             case '\\': {                        /* Escape character */
                 PTR_INC();                      /* Go to next character */
                 switch (*p) {
@@ -174,6 +387,9 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                         patterns[i].type = P_CHAR_CLASS;
                         patterns[i].str = p - 1;
                         patterns[i].len = 2;    /* We have 2 characters long pattern */
+                        if (!compile_class(r, &patterns[i], fold)) {
+                            return 0;
+                        }
                         break;
                     default:
                         patterns[i].type = P_CHAR;  /* Treat it as normal character */
@@ -196,6 +412,9 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                     patterns[i].len++;
                     PTR_INC();
                 }
+                if (!compile_class(r, &patterns[i], fold)) {
+                    return 0;
+                }
                 break;
             }
             case '{': {                         /* Length parameter, not necessary valid one? */
@@ -209,16 +428,16 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                 uint8_t type = 0;
                 uint32_t num1 = 0, num2 = 0;
                 if (IS_DIGIT(*tmp)) {           /* At least one digit must be followed by { */
-                    while (IS_DIGIT(*tmp)) {
-                        num1 = num1 * 10 + CHAR_TO_NUM(*tmp++);
+                    if (!parse_count(&tmp, &num1)) {
+                        return 0;               /* Number of repetitions is too big */
                     }
                     if (*tmp == ',') {          /* Check if comma exists */
                         tmp++;                  /* Go to next character */
                         type = 2;
                         if (IS_DIGIT(*tmp)) {   /* We also have set maximal value as second one */
                             type = 3;
-                            while (IS_DIGIT(*tmp)) {
-                                num2 = num2 * 10 + CHAR_TO_NUM(*tmp++);
+                            if (!parse_count(&tmp, &num2)) {
+                                return 0;
                             }
                             if (num1 > num2) {  /* Check valid range */
                                 type = 0;       /* Failed! */
@@ -232,12 +451,10 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                     }
                 }
                 /* Process forward to default */
-                if (type && i) {
+                if (type) {
                     p_t* pattern;
-                    if (i > 1 && (patterns[i - 1].type == P_CAPTURE_START || patterns[i - 1].type == P_CAPTURE_END)) {
-                        pattern = &patterns[i - 2];
-                    } else {
-                        pattern = &patterns[i - 1];
+                    if ((pattern = compile_quant(r, i)) == NULL) {
+                        return 0;               /* Nothing to repeat */
                     }
                     while (p != tmp) {          /* Do it until they are not the same */
                         PTR_INC();              /* Increase input string */
@@ -248,6 +465,7 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                         case 3: pattern->min = num1; pattern->max = num2; break;
                         default: return 0;
                     }
+                    quant = pattern;
                     continue;
                 }
             };
@@ -276,35 +494,289 @@ compile_pattern(regex_t* r, const char* p, size_t len) {
                 }
             }
         }
+        if (fold && patterns[i].type == P_CHAR && IS_C_ALPHA(patterns[i].ch)) {  /* Letter matches both cases */
+            patterns[i].type = P_CHAR_CLASS;
+            patterns[i].str = p;
+            patterns[i].len = 1;
+            if (!compile_class(r, &patterns[i], fold)) {
+                return 0;
+            }
+        } else if (fold && patterns[i].type == P_CHAR_SEQUENCE) {
+            for (b = 0; b < patterns[i].len && !IS_C_ALPHA(patterns[i].str[b]); b++) {}
+            if (b < patterns[i].len) {          /* Sequence without letters is compared exactly */
+                patterns[i].type = P_CHAR_SEQUENCE_FOLD;
+            }
+        }
         i++;
 ignore:
         PTR_INC();
     }
+    if (alt) {                                  /* Enclose alternation in group, anchors stay outside */
+        if (i + 2 > r->p_totlen) {
+            return 0;
+        }
+        b = i > 0 && patterns[0].type == P_BEGIN;
+        e = i > b && patterns[i - 1].type == P_END ? i - 1 : i;
+        memmove(&patterns[e + 2], &patterns[e], (i - e) * sizeof(patterns[0]));
+        memmove(&patterns[b + 1], &patterns[b], (e - b) * sizeof(patterns[0]));
+        memset(&patterns[b], 0x00, sizeof(patterns[0]));
+        memset(&patterns[e + 1], 0x00, sizeof(patterns[0]));
+        patterns[b].type = P_CAPTURE_START;
+        patterns[e + 1].type = P_CAPTURE_END;
+        patterns[b].grp = patterns[e + 1].grp = GRP_NONE;
+        i += 2;
+    }
+    if (i >= r->p_totlen) {                     /* No space for terminating entry */
+        return 0;
+    }
+    memset(&patterns[i], 0x00, sizeof(patterns[0]));
     patterns[i].type = P_EMPTY;                 /* Last pattern is always empty */
     r->p_len = i + 1;                           /* Set total length used */
+    return compile_links(patterns, &e);         /* Check groups before they are optimized */
+}
+
+/*
+ * Pattern optimizer
+ *
+ * Compiled pattern list is simplified after parsing, so every engine has fewer entries to dispatch on.
+ * Alternation is scoped by groups, so entries are rewritten the same way next to OR.
+ * Groups are linked again after entries are moved, see \ref compile_links.
+ * Results, spans and groups are the same as without optimization.
+ */
+
+#define OPT_PLAIN(p)                            (!(p)->min && !(p)->max)    /*!< Entry is matched exactly once */
+#define OPT_LITERAL(p)                          (IS_SEQUENCE((p)->type) && OPT_PLAIN(p) && memchr((p)->str, '\\', (p)->len) == NULL)
+#define OPT_FOLD(a, b)                          ((a)->type == P_CHAR_SEQUENCE_FOLD || (b)->type == P_CHAR_SEQUENCE_FOLD)    /*!< Literals are compared in any case */
+
+/**
+ * \brief           Replace character classes with simpler entries
+ *
+ * Negation is already folded in class set, so all classes become \ref P_CHAR_CLASS.
+ * Class with all bytes is \ref P_DOT and class with single byte is \ref P_CHAR.
+ *
+ * \param[in]       p: Pointer to class entry
+ */
+static void
+opt_class(const regex_t* r, p_t* p) {
+    const regex_class_t* c = &r->c[p->cls];
+    size_t i, cnt = 0;
+    char ch = 0;
+
+    for (i = 0; i < 256; i++) {
+        if (CLASS_HAS(c, i)) {
+            ch = (char)i;
+            cnt++;
+        }
+    }
+    p->type = P_CHAR_CLASS;
+    if (cnt == 256) {
+        p->type = P_DOT;
+    } else if (cnt == 1) {
+        p->type = P_CHAR;
+        p->str = NULL;
+        p->ch = ch;
+    }
+}
+
+/**
+ * \brief           Factor common prefix out of group with alternation of literal sequences
+ *
+ * `(abc|abd)` is matched as `(ab(c|d))` with internal group, so prefix is compared only once.
+ * Prefix of internal group matched once is moved before the group, `abc|abd` is matched as `ab(c|d)`.
+ * Alternatives are tried in the same order on the same positions as before.
+ * Letters are compared in any case, when one of the literals is case-insensitive.
+ * Nothing is done when pattern array is full.
+ *
+ * \param[in]       i: Index of group start in pattern list
+ * \return          1 if alternation was factored, 0 otherwise
+ */
+static uint8_t
+opt_factor(regex_t* r, size_t i) {
+    p_t* p = r->p;
+    size_t j, k, last, n;
+
+    if (!OPT_LITERAL(&p[i + 1]) || p[i + 2].type != P_OR) {
+        return 0;
+    }
+    for (k = p[i + 1].len, j = i + 1; p[j + 1].type == P_OR; j += 2) {  /* All alternatives must be literals */
+        if (!OPT_LITERAL(&p[j + 2])) {
+            return 0;
+        }
+        for (last = 0; last < k && (p[i + 1].str[last] == p[j + 2].str[last]
+                                    || (OPT_FOLD(&p[i + 1], &p[j + 2]) && FOLD(p[i + 1].str[last]) == FOLD(p[j + 2].str[last]))); last++) {}
+        k = last;                               /* Common prefix of all alternatives so far */
+    }
+    if (p[j + 1].type != P_CAPTURE_END) {       /* Alternation must be entire group */
+        return 0;
+    }
+    last = j;
+    for (j = i + 1; j <= last; j += 2) {        /* Every alternative must keep at least one character */
+        if (k >= p[j].len) {
+            k = 0;
+        }
+    }
+    n = p[i].grp == GRP_NONE && OPT_PLAIN(&p[last + 1]) ? 1 : 3;   /* Entries to insert */
+    if (!k || r->p_len + n > r->p_totlen) {
+        return 0;
+    }
+    if (n == 1) {                               /* Prefix goes before group */
+        memmove(&p[i + 1], &p[i], (r->p_len - i) * sizeof(*p));
+        p[i] = p[i + 2];
+        i++;
+    } else {                                    /* Prefix and internal group go inside group */
+        memmove(&p[last + 4], &p[last + 1], (r->p_len - last - 1) * sizeof(*p));
+        memmove(&p[i + 3], &p[i + 1], (last - i) * sizeof(*p));
+        p[i + 1] = p[i + 3];
+        memset(&p[i + 2], 0x00, sizeof(*p));
+        memset(&p[last + 3], 0x00, sizeof(*p));
+        p[i + 2].type = P_CAPTURE_START;
+        p[last + 3].type = P_CAPTURE_END;
+        p[i + 2].grp = p[last + 3].grp = GRP_NONE;
+        i += 2;
+    }
+    r->p_len += n;
+    p[i - 1].len = (uint32_t)k;                 /* Prefix uses source text of first alternative */
+    for (j = i + 1; j <= last + n; j += 2) {
+        p[j].str += k;
+        p[j].len -= (uint32_t)k;
+    }
     return 1;
 }
 
+/**
+ * \brief           Make repetitions of entry possessive, when they never overlap with rest of pattern
+ *
+ * Rest of pattern must not match empty string and none of its first bytes may match entry, such as `\d+,`.
+ * Lazy repetitions then let rest of pattern match only at the end of the run,
+ * so run is consumed first and rest of pattern is tried once instead of after each repetition.
+ *
+ * \param[in]       p: Pointer to entry with repetitions
+ */
+static void
+opt_possessive(const regex_t* r, p_t* p) {
+    regex_class_t a, b;
+    size_t i;
+
+    memset(&a, 0x00, sizeof(a));
+    memset(&b, 0x00, sizeof(b));
+    compile_first_atom(r, &a, p);
+    if (compile_first_pattern(r, p + 1, &b)) {  /* Rest may match anywhere */
+        return;
+    }
+    for (i = 0; i < sizeof(a.set); i++) {
+        if (a.set[i] & b.set[i]) {
+            return;
+        }
+    }
+    p->poss = POSS_AUTO;
+}
+
+/**
+ * \brief           Optimize compiled pattern list in place
+ *
+ * Following rewrites are done:
+ *  - Classes are canonicalized, see \ref opt_class
+ *  - Repetition `{1}` or `{1,1}` is removed
+ *  - Literal split by sequence heuristic of \ref compile_pattern is merged back,
+ *      such as `a` and `b` of `ab.`
+ *  - Common prefix of literal alternatives is factored out, see \ref opt_factor
+ *  - Literal sequence of one character is \ref P_CHAR
+ *  - Groups are linked again and nesting depth of repeated groups is set to \ref regex_t.loop_depth
+ *  - Repeated character or class, which never overlaps with rest of pattern, is possessive, see \ref opt_possessive
+ *
+ * \param[in]       r: Regex with just compiled pattern in \ref regex_t.p
+ */
+static void
+optimize_pattern(regex_t* r) {
+    p_t* p = r->p;
+    size_t i;
+
+    for (i = 0; p[i].type != P_EMPTY; i++) {
+        if (p[i].type == P_CHAR_CLASS || p[i].type == P_CHAR_CLASS_NOT) {
+            opt_class(r, &p[i]);
+        }
+        if (p[i].min == 1 && p[i].max == 1) {
+            p[i].min = p[i].max = 0;
+            p[i].poss = 0;
+        }
+    }
+
+    /* Merge adjacent literals, which are next to each other in source pattern */
+    for (i = 0; p[i].type != P_EMPTY;) {
+        if (OPT_LITERAL(&p[i]) && (p[i + 1].type == P_CHAR || OPT_LITERAL(&p[i + 1])) && OPT_PLAIN(&p[i + 1])
+            && ((p[i + 1].type == P_CHAR && p[i + 1].ch != '\\' && p[i].str[p[i].len] == p[i + 1].ch)
+                || (IS_SEQUENCE(p[i + 1].type) && p[i].str + p[i].len == p[i + 1].str))) {
+            p[i].len += p[i + 1].type == P_CHAR ? 1 : p[i + 1].len;
+            if (p[i + 1].type == P_CHAR_SEQUENCE_FOLD) {    /* Letters of merged literal keep matching any case */
+                p[i].type = P_CHAR_SEQUENCE_FOLD;
+            }
+            memmove(&p[i + 1], &p[i + 2], (r->p_len - i - 2) * sizeof(*p));
+            r->p_len--;
+            continue;                           /* Try to merge next one too */
+        }
+        i++;
+    }
+
+    for (i = 0; p[i].type != P_EMPTY; i++) {
+        if (p[i].type == P_CAPTURE_START) {
+            opt_factor(r, i);
+        }
+    }
+
+    for (i = 0; p[i].type != P_EMPTY; i++) {
+        if (p[i].type == P_CHAR_SEQUENCE && p[i].len == 1 && p[i].str[0] != '\\') {
+            p[i].type = P_CHAR;
+            p[i].ch = p[i].str[0];
+        }
+    }
+
+    (void)compile_links(p, &i);                 /* Entries were moved, groups stay balanced */
+    if (i > r->loop_depth) {
+        r->loop_depth = i;
+    }
+    for (i = 0; p[i].type != P_EMPTY; i++) {
+        if ((p[i].type == P_CHAR || p[i].type == P_CHAR_CLASS) && !OPT_PLAIN(&p[i]) && !p[i].poss
+            && CAN_MATCH_MORE((p + i))) {
+            opt_possessive(r, &p[i]);
+        }
+    }
+}
+
 /**
  * \brief           Checks if pattern starts and ends with correct characters such as /pattern/g
+ * \note            Flags after closing '/' are `g`, which is mandatory, and optional `i`, in any order
  * \param[in]       pattern: Pointer to pattern to test
+ * \param[out]      fold: Output set to 1 when `i` flag is used
  * \return          1 if ok, 0 otherwise
  */
 static uint8_t
-analyze_pattern(regex_t* r, const char** pat, size_t* length) {
-    size_t len;
+analyze_pattern(regex_t* r, const char** pat, size_t* length, uint8_t* fold) {
+    size_t len, f;
     int8_t brackets;                            /* Number of round, square and curly brackets */
+    uint8_t flags = 0;                          /* Bit 0 for `g`, bit 1 for `i` */
     const char* pattern = *pat;
     len = strlen(pattern);                      /* Get pattern length */
 
     /**
-     * Check if pattern is in format "/pattern/g"
+     * Check if pattern is in format "/pattern/g", flags follow last '/'
      */
-    if (pattern[0] != '/' || pattern[len - 2] != '/' || pattern[len - 1] != 'g') {
+    for (f = len; f > 0 && pattern[f - 1] != '/'; f--) {
+        if (pattern[f - 1] == 'g' && !(flags & 0x01)) {
+            flags |= 0x01;
+        } else if (pattern[f - 1] == 'i' && !(flags & 0x02)) {
+            flags |= 0x02;
+        } else {
+            return 0;                           /* Unknown or repeated flag */
+        }
+    }
+    if (f < 2 || pattern[0] != '/' || !(flags & 0x01)) {
+        return 0;
+    } else if ((size_t)(uint32_t)len != len) {  /* Length of each entry must fit to 32 bits */
         return 0;
     }
     *pat = ++pattern;                           /* Set the pointer */
-    *length = len - 3;                          /* Set length of pattern */
+    *length = f - 2;                            /* Set length of pattern */
+    *fold = (flags & 0x02) != 0;
 
     /**
      * Check if there are same number of opening and closed brackets
@@ -341,7 +813,7 @@ analyze_pattern(regex_t* r, const char** pat, size_t* length) {
  * \return          1 if match, 0 otherwise
  */
 static uint8_t
-match_class_range(regex_t* r, const char* str, size_t len, const char* in_str) {
+match_class_range(const regex_t* r, const char* str, size_t len, const char* in_str) {
     /**
      * To get a range match, we need:
      *  - Length of range string must be at least 3 characters
@@ -362,7 +834,7 @@ match_class_range(regex_t* r, const char* str, size_t len, const char* in_str) {
  * \return          1 if match, 0 otherwise
  */
 static uint8_t
-match_special_char(regex_t* r, const p_t* p, char s_c, const char* str) {
+match_special_char(const regex_t* r, const p_t* p, char s_c, const char* str) {
     uint8_t result = 0;
     switch (IS_C_UPPER(s_c) ? s_c : s_c - 0x20) {   /* Process only lowercase letters */
         case 'S': result = IS_S_CHAR(*str); break;  /* Check for whitespace */
@@ -378,12 +850,13 @@ match_special_char(regex_t* r, const p_t* p, char s_c, const char* str) {
 
 /**
  * \brief           Match character class such as [0-9] or [0-9a-zA-Z] or similar
+ * \note            Used only during compilation to build class set
  * \param[in]       p: Pointer to exact pattern with character class included
  * \param[in]       c: Character to test in character class
  * \return          1 if match, 0 otherwise
  */
 static uint8_t 
-match_class_char(regex_t* r, const p_t* p, const char* str) {
+match_class_char(const regex_t* r, const p_t* p, const char* str) {
     size_t i;
     for (i = 0; i < p->len; i++) {              /* Process input group string */
         /**
@@ -431,28 +904,109 @@ match_class_char(regex_t* r, const p_t* p, const char* str) {
  * \return          1 if match, 0 otherwise
  */
 static uint8_t
-match_one_char(regex_t* r, const p_t* p, const char* str) {
+match_one_char(regex_match_ctx_t* ctx, const p_t* p, const char* str) {
     if (p->type == P_DOT) {                     /* Match any character */
         return 1;                               /* This one was successful */
-    } else if (p->type == P_CHAR_CLASS) {       /* Match character class such [a-zA-Z0-9] */
-        return match_class_char(r, p, str);
-    } else if (p->type == P_CHAR_CLASS_NOT) {   /* Match character class such as [^a-zA-Z0-9] */
-        return !match_class_char(r, p, str);
+    } else if (p->type == P_CHAR_CLASS || p->type == P_CHAR_CLASS_NOT) {  /* Match compiled character class such [a-zA-Z0-9] or [^a-zA-Z0-9] */
+        REGEX_STAT(ctx, class_tests);
+        return CLASS_HAS(&ctx->r->c[p->cls], *str) != 0;
     } else {
         return p->ch == *str;
     }
     return 0;
 }
 
+/**
+ * \brief           Count characters in a row, which match single character pattern
+ *
+ * Vector kernels test 16 characters at a time, single character with compare
+ * and class with lookup of its set, byte by upper 5 bits and bit by lower 3 bits of character.
+ *
+ * \param[in]       p: Pointer to pattern entry, \ref IS_ONE_CHAR must be true
+ * \param[in]       str: Input string to start at
+ * \param[in]       n: Maximal number of characters to count, not more than remaining input
+ * \return          Number of matching characters from start of input
+ */
+static size_t
+match_run(regex_match_ctx_t* ctx, const p_t* p, const char* str, size_t n) {
+    const regex_class_t* c = NULL;
+    size_t i = 0;
+
+    if (p->type == P_DOT) {                     /* Any character matches */
+        return n;
+    } else if (p->type == P_CHAR_CLASS || p->type == P_CHAR_CLASS_NOT) {
+        REGEX_STAT(ctx, class_tests);
+        c = &ctx->r->c[p->cls];
+    }
+#if REGEX_CFG_SIMD && defined(__SSE2__)
+    if (c == NULL) {
+        __m128i ch = _mm_set1_epi8(p->ch);
+        int m;
+        for (; n - i >= 16; i += 16) {
+            m = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(str + i)), ch)) & 0xFFFF;
+            if (m) {                            /* First different character ends the run */
+                for (; !(m & 1); m >>= 1, i++) {}
+                return i;
+            }
+        }
+    }
+#if defined(__SSSE3__)
+    else {
+        __m128i lo = _mm_loadu_si128((const __m128i*)&c->set[0]), hi = _mm_loadu_si128((const __m128i*)&c->set[16]);
+        __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        __m128i d, idx, sel, row, bit;
+        int m;
+        for (; n - i >= 16; i += 16) {
+            d = _mm_loadu_si128((const __m128i*)(str + i));
+            idx = _mm_and_si128(_mm_srli_epi16(d, 3), _mm_set1_epi8(0x1F));
+            sel = _mm_cmpgt_epi8(idx, _mm_set1_epi8(0x0F)); /* Index with top bit set gives zero */
+            row = _mm_or_si128(_mm_shuffle_epi8(lo, _mm_or_si128(idx, sel)), _mm_shuffle_epi8(hi, _mm_or_si128(idx, _mm_xor_si128(sel, _mm_set1_epi8(-1)))));
+            bit = _mm_shuffle_epi8(bits, _mm_and_si128(d, _mm_set1_epi8(0x07)));
+            m = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)) & 0xFFFF;
+            if (m) {
+                for (; !(m & 1); m >>= 1, i++) {}
+                return i;
+            }
+        }
+    }
+#endif /* defined(__SSSE3__) */
+#elif REGEX_CFG_SIMD && defined(__aarch64__)
+    if (c == NULL) {
+        uint8x16_t ch = vdupq_n_u8((uint8_t)p->ch);
+        for (; n - i >= 16; i += 16) {
+            if (vminvq_u8(vceqq_u8(vld1q_u8((const uint8_t*)(str + i)), ch)) != 0xFF) {
+                break;                          /* Exact position is found by scalar loop */
+            }
+        }
+    } else {
+        uint8x16x2_t set = {{vld1q_u8(&c->set[0]), vld1q_u8(&c->set[16])}};
+        uint8x16_t d, bit;
+        for (; n - i >= 16; i += 16) {
+            d = vld1q_u8((const uint8_t*)(str + i));
+            bit = vshlq_u8(vdupq_n_u8(1), vreinterpretq_s8_u8(vandq_u8(d, vdupq_n_u8(0x07))));
+            if (vminvq_u8(vtstq_u8(vqtbl2q_u8(set, vshrq_n_u8(d, 3)), bit)) != 0xFF) {
+                break;
+            }
+        }
+    }
+#endif /* REGEX_CFG_SIMD */
+    for (; i < n; i++) {                        /* Remaining characters one by one */
+        if (c != NULL ? !CLASS_HAS(c, str[i]) : str[i] != p->ch) {
+            break;
+        }
+    }
+    return i;
+}
+
 /**
  * \brief           Matches char sequence
+ * \note            Letters of \ref P_CHAR_SEQUENCE_FOLD are compared in any case, only after exact compare fails
  * \param[in]       p: Pointer to current pattern holding char sequence
  * \param[in]       str: Input string to match sequence
- * \param[in]       con: 1 to continue to match next pattern, 0 to just return status of match
- * \return          1 if match, 0 otherwise
+ * \return          Pointer to input after matched sequence, `NULL` if there is no match
  */
-static uint8_t
-match_char_sequence(regex_t* r, const p_t* p, const char* str, uint8_t cont) {
+static const char*
+match_char_sequence(regex_match_ctx_t* ctx, const p_t* p, const char* str) {
     size_t i;
     const char* s = str;
 
@@ -463,263 +1017,3694 @@ match_char_sequence(regex_t* r, const p_t* p, const char* str, uint8_t cont) {
      *  - Compare actual char by char and check if there is a match
      */
     for (i = 0; i < p->len; i++) {
-        if (!*s) {                              /* If source string is empty */
+        if (s >= ctx->end) {                    /* If source string is empty */
             break;                              /* Stop execution immediatelly */
         }
         if (p->str[i] == '\\') {                /* Check for escape string */
             i++;                                /* Just move to next one */
         }
-        if (*s != p->str[i]) {                  /* Compare actual string values */
+        if (*s != p->str[i] && (p->type != P_CHAR_SEQUENCE_FOLD || FOLD(*s) != FOLD(p->str[i]))) {    /* Compare actual string values */
             break;                              /* Finish as they failed */
         }
         s++;                                    /* Go to next source */
     }
+    return i == p->len ? s : NULL;              /* All characters matched? */
+}
 
-    /**
-     * If we have a match, proceed with next check
-     */
-    if (i == p->len) {                          /* All characters matched? */
-        return cont ? match_pattern(r, p + 1, s, 1) : 1;/* Continue with matched source or just return positive result */
-    }
-    return 0;                                   /* No match here! */
+/*
+ * Backtracking engine
+ *
+ * Pattern entries are matched in a loop with explicit stack of frames instead of recursive calls.
+ * Frame is pushed when rest of pattern is tried and its result decides what to do next:
+ * try next alternative of group, skip entry with repetitions, match one more repetition
+ * or change number of iterations of repeated group.
+ * Without repeated groups each pattern entry has at most one frame of each kind on the stack,
+ * so stack depth depends only on pattern length and never on input length.
+ * Iteration of repeated group keeps its frames only while choice frames of it are on the stack,
+ * so stack depth then grows with input length only by choices left behind in iterations.
+ *
+ * Result of rest of pattern depends only on pattern entry and input position it starts at.
+ * When context has memory for visited bitmap of all (entry, position) pairs of the search,
+ * failed pairs are marked and never tried again. Matching time is then polynomial
+ * in pattern and input length, also for patterns which otherwise backtrack exponentially.
+ * Rest of pattern inside repeated group also depends on iterations done. Bitmap is used there only
+ * when each open iteration has at least minimum count of group without maximum and already consumed input,
+ * which continue the same for any count and start. Failed iteration of such group is marked too,
+ * on entry after group end, which is never rest of pattern after repetition.
+ */
+
+#define BT_PATTERN                              0       /*!< Match pattern entries from current position */
+#define BT_RANGE                                1       /*!< Start matching entry with repetitions */
+#define BT_RANGE_LOOP                           2       /*!< Match next repetition */
+#define BT_RANGE_END                            3       /*!< Check number of repetitions and continue with rest of pattern */
+#define BT_GROUP_LOOP                           4       /*!< Decide between next iteration of repeated group and rest of pattern */
+#define BT_GROUP_ITER                           5       /*!< Start next iteration of repeated group */
+#define BT_GROUP_END                            6       /*!< Finish iteration at end of repeated group */
+#define BT_RETURN                               7       /*!< Return result to frame on top of stack */
+
+#define BT_FRAME_OR                             0       /*!< Try next alternative of group if rest of pattern failed */
+#define BT_FRAME_SKIP                           1       /*!< Match entry with repetitions if rest of pattern failed without it */
+#define BT_FRAME_REPEAT                         2       /*!< Match one more repetition if rest of pattern failed */
+#define BT_FRAME_ITER                           3       /*!< Iteration of repeated group, holds its start and number of iterations before */
+#define BT_FRAME_MORE                           4       /*!< Match one more iteration of group if rest of pattern failed */
+#define BT_FRAME_EXIT                           5       /*!< Continue after group if next iteration failed */
+#define BT_FRAME_UNDO                           6       /*!< Restore capturing group, when path which recorded it failed */
+#define BT_FRAME_LESS                           7       /*!< Give back one repetition of greedy entry if rest of pattern failed */
+
+#define BT_FRAMES(p_len)                        (2 * (p_len) + 1)   /*!< Maximal stack depth for pattern list length */
+#define BT_LOOP_FRAMES(p_len, depth, len)       (2 * BT_FRAMES(p_len) * ((depth) * ((size_t)(len) + 1) + 1))  /*!< Maximal stack depth with repeated groups for input length */
+#define BT_VISIT_MEM(p_len, len)                (((size_t)(p_len) * ((len) + 1) + 7) / 8)  /*!< Visited bitmap bytes for pattern list and input length */
+#define BT_CAPTURED(ctx, p)                     ((p)->grp != GRP_NONE && (p)->grp < (ctx)->m_totlen)    /*!< Group is recorded to user array */
+
+/**
+ * \brief           Get bit index of pattern entry and input position in visited bitmap
+ */
+#define BT_VISIT_IDX(ctx, e, s)                 ((size_t)((e) - (ctx)->r->p) * (size_t)((ctx)->end - (ctx)->visit_s + 1) + (size_t)((s) - (ctx)->visit_s))
+
+/**
+ * \brief           Check if rest of pattern from entry and input position already failed, with open iterations of `iter`
+ */
+#define BT_VISITED(ctx, e, s)                   ((ctx)->visit_s != NULL && bt_iter_free(stack, iter, (s)) \
+                                                    && ((ctx)->visit[BT_VISIT_IDX(ctx, e, s) >> 3] & (1 << (BT_VISIT_IDX(ctx, e, s) & 0x07))))
+
+/**
+ * \brief           Mark rest of pattern from entry and input position as failed, with open iterations of `iter`
+ */
+#define BT_VISIT(ctx, e, s)     do {                                    \
+        if ((ctx)->visit_s != NULL && bt_iter_free(stack, iter, (s))) { \
+            size_t i_ = BT_VISIT_IDX(ctx, e, s);                        \
+            (ctx)->visit[i_ >> 3] |= 1 << (i_ & 0x07);                  \
+        }                                                               \
+    } while (0)
+
+/**
+ * \brief           Check if iteration of repeated group `g` with `cnt` iterations before continues the same for any count
+ */
+#define BT_ITER_ANY(g, cnt)                     ((g)[(g)->len].max == RANGE_MAX && (cnt) >= (g)[(g)->len].min)
+
+/**
+ * \brief           Accept match ending on input position, sets `result`
+ *
+ * Match must end on required position, when it is set.
+ * For longest match, end is only remembered and path fails, so all other paths from the same start are tried too.
+ * Match ending on the end of input cannot be extended and is accepted right away.
+ */
+#define BT_ACCEPT(ctx, e)       do {                                    \
+        result = (ctx)->m_req == NULL || (e) == (ctx)->m_req;           \
+        if (result && (ctx)->m_req == NULL && ((ctx)->mode & REGEX_MODE_LONGEST) && (e) != (ctx)->end) { \
+            if ((ctx)->m_best == NULL || (e) > (ctx)->m_best) {         \
+                (ctx)->m_best = (e);                                    \
+            }                                                           \
+            result = 0;                                                 \
+        }                                                               \
+        (ctx)->m_end = (e);                                             \
+    } while (0)
+
+/**
+ * \brief           Backtracking stack frame
+ */
+typedef struct {
+    const p_t* p;                               /*!< Pattern entry */
+    const char* s;                              /*!< Input position at pattern entry, group start for undo frame */
+    size_t cnt;                                 /*!< Number of repetitions matched so far, group length for undo frame */
+    size_t iter;                                /*!< Iteration frame of innermost open repeated group when pushed, as index plus 1, `0` if none */
+    uint8_t type;                               /*!< Frame type, BT_FRAME_* */
+    uint8_t greedy;                             /*!< Set when pushed inside iteration of possessive group, where repetitions are greedy */
+} bt_frame_t;
+
+/**
+ * \brief           Push frame with given values to backtracking stack or stop matching when it is full
+ */
+#define BT_PUSH_FRAME(t, fp, fs, fcnt)  do {                            \
+        if (top == stack_len) {                                         \
+            return REGEX_EXHAUSTED;                                     \
+        }                                                               \
+        stack[top].p = (fp);                                            \
+        stack[top].s = (fs);                                            \
+        stack[top].cnt = (fcnt);                                        \
+        stack[top].iter = iter;                                         \
+        stack[top].type = (t);                                          \
+        stack[top].greedy = greedy;                                     \
+        top++;                                                          \
+    } while (0)
+
+/**
+ * \brief           Push frame of current state to backtracking stack, counted as attempt
+ */
+#define BT_PUSH(t)              do {                                    \
+        BT_PUSH_FRAME((t), p, s, cnt);                                  \
+        REGEX_STAT(ctx, attempts);                                      \
+    } while (0)
+
+/**
+ * \brief           Enter group on group start entry `p`
+ *
+ * Capturing group start is recorded, previous values are restored when path fails.
+ * Next alternative is tried when rest of pattern fails.
+ */
+#define BT_ENTER_GROUP()        do {                                    \
+        if (BT_CAPTURED(ctx, p)) {                                      \
+            BT_PUSH_FRAME(BT_FRAME_UNDO, p, ctx->matches[p->grp].s, ctx->matches[p->grp].len); \
+            ctx->matches[p->grp].s = s;                                 \
+            ctx->matches[p->grp].len = 0;                               \
+        }                                                               \
+        if (p->alt) {                                                   \
+            BT_PUSH(BT_FRAME_OR);                                       \
+        }                                                               \
+        p++;                                                            \
+    } while (0)
+
+/**
+ * \brief           Check if any frame from given index is choice frame, path may continue from it
+ * \param[in]       stack: Backtracking stack
+ * \param[in]       base: Index of first frame to check
+ * \param[in]       top: Number of frames on stack
+ * \return          1 if choice frame is on stack, 0 if there are only undo frames
+ */
+static uint8_t
+bt_has_choice(const bt_frame_t* stack, size_t base, size_t top) {
+    for (; base < top && stack[base].type == BT_FRAME_UNDO; base++) {}
+    return base < top;
 }
 
 /**
- * \brief           Match pattern range with {min,max} values, such as [0-9]{1,2} or similar
- * \note            It can match only single char or char sequence
- * \param[in]       p: Pointer to current pattern to test for
- * \param[in]       str: Pointer to string to test
- * \return          1 if match, 0 otherwise
+ * \brief           Check if rest of pattern on input position does not depend on open iterations
+ * \param[in]       stack: Backtracking stack
+ * \param[in]       iter: Iteration frame of innermost open repeated group, as index plus 1, `0` if none
+ * \param[in]       s: Input position
+ * \return          1 if every open iteration continues the same for any count and start, 0 otherwise
  */
 static uint8_t
-match_pattern_range(regex_t* r, const p_t* p, const char* str) {
-    int16_t cnt = 0;
-    const char* s = str;
-    
-    /**
-     * Process entire string and check for matches
-     */
-    while (cnt < p->max && *s) {                /* Process entire string or while we didn't reach maximum */
-        if (p->type == P_CHAR_SEQUENCE) {       /* Check for char sequence */
-            if (!match_char_sequence(r, p, s, 0)) { /* Try to match char sequence, but do not continue with other matches if there is a match */
-                break;                          /* Stop execution when failed */
-            }
-            s += p->len;                        /* Increase character pointer for next entry by length of sequence */
-        } else {                                /* Try to match single char only */
-            if (!match_one_char(r, p, s)) {     /* Process with match */
-                break;
-            }
-            s++;
-        }
+bt_iter_free(const bt_frame_t* stack, size_t iter, const char* s) {
+    const bt_frame_t* f;
 
-        cnt++;                                  /* Count number of matches */
-        if (CAN_MATCH_MORE(p)) {                /* If last one is ont empty */
-            if (match_pattern(r, p + 1, s, 0)) {/* Match next one? */
-                if (cnt >= p->min) {
-                    break;
-                }
-            }
+    for (; iter; iter = f->iter) {
+        f = &stack[iter - 1];
+        if (!BT_ITER_ANY(f->p, f->cnt) || f->s == s) {  /* Empty iteration would end repetitions */
+            return 0;
         }
     }
-    if (cnt >= p->min && cnt <= p->max) {       /* Now check how many entries we have */
-        return CAN_MATCH_MORE(p) ? match_pattern(r, p + 1, s, 1) : 1;   /* We are in valid range */
-    }
-    return 0;                                   /* Invalid match */
+    return 1;
 }
 
 /**
- * \brief           Match current pattern and check next one if required
- * \param[in]       p: Pointer to current pattern to match
- * \param[in]       str: Pointer to string to test pattern on
- * \param[in]       prev_result: Indicates previous result for OR operations
- * \return          1 if match, 0 otherwise
- */
+ * \brief           Drop frames of finished iteration, keep undo frames of its groups
+ *
+ * Used for committed possessive iteration and for iteration without choice frames,
+ * so stack grows only with choice frames and not with number of iterations.
+ * Undo frames without choice frame between them are always popped together,
+ * only oldest undo frame of each group in such run is kept.
+ *
+ * \param[in]       stack: Backtracking stack
+ * \param[in]       base: Index of first frame to drop
+ * \param[in]       top: Number of frames on stack
+ * \param[in]       iter: Iteration frame of innermost open repeated group after commit, set to kept frames
+ * \return          Number of frames on stack after commit
+ */
+static size_t
+bt_commit(bt_frame_t* stack, size_t base, size_t top, size_t iter) {
+    size_t i, j;
+
+    for (i = base; i < top; i++) {
+        if (stack[i].type != BT_FRAME_UNDO) {
+            continue;
+        }
+        for (j = base; j > 0 && stack[j - 1].type == BT_FRAME_UNDO && stack[j - 1].p != stack[i].p; j--) {}
+        if (j == 0 || stack[j - 1].type != BT_FRAME_UNDO) {    /* No older value of group in run */
+            stack[base] = stack[i];
+            stack[base].iter = iter;
+            base++;
+        }
+    }
+    return base;
+}
+
+/**
+ * \brief           Match pattern entries on input position
+ *
+ * Repetitions are lazy, they stop as soon as rest of pattern matches.
+ * Possessive repetitions match as many times as possible and rest of pattern is tried only once.
+ * Inside iteration of possessive group repetitions are greedy and give back one at a time,
+ * first match of iteration found this way is kept, as by PCRE.
+ * Repetitions at the end of pattern are greedy, rest of pattern is always matched then.
+ * Alternation selects first alternative of group which lets rest of pattern match.
+ * Iteration of repeated group which matches empty string ends the repetitions.
+ *
+ * \param[in]       stack: Backtracking stack
+ * \param[in]       stack_len: Number of frames in stack
+ * \param[in]       p: Pointer to first pattern entry to match
+ * \param[in]       str: Pointer to string to test pattern on
+ * \return          1 if match, 0 otherwise, \ref REGEX_EXHAUSTED if stack is full or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
 static uint8_t
-match_pattern(regex_t* r, const p_t* p, const char* str, uint8_t prev_result) {
-    const char* s = str;
-    uint8_t result = 0, ret = 0;
-    do {
-        if (p[0].type == P_OR) {                /* Is current pattern OR? */
-            if (prev_result) {                  /* If result of previous operation was positive */
-                prev_result = 0;                /* Reset result */
-                while (p[0].type == P_OR) {     /* Ignore all others followed by OR */
-                    p += 2;                     /* Ignore OR + next after OR */
+match_pattern(regex_match_ctx_t* ctx, bt_frame_t* stack, size_t stack_len, const p_t* p, const char* str) {
+    const bt_frame_t* f;
+    const char* s = str, *n;
+    size_t top = 0, cnt = 0, iter = 0, k;
+    uint8_t op = BT_PATTERN, result = 0, greedy = 0;
+
+    for (;;) {
+        if (++ctx->steps > ctx->step_limit && ctx->step_limit) {    /* Each entry check and backtrack is a step */
+            return REGEX_BUDGET_EXCEEDED;
+        }
+        switch (op) {
+            case BT_PATTERN: {
+                REGEX_DEBUG(ctx->r, REGEX_EVT_PATTERN, p, s);
+                if (p->type == P_OR) {          /* Alternative matched, rest of pattern continues after group */
+                    p += p->len;
+                    continue;
+                }
+
+                /**
+                 * Record capturing groups directly to user array.
+                 * Values are restored from undo frames on backtracking,
+                 * last written values belong to successful path
+                 */
+                if (p->type == P_CAPTURE_START) {
+                    if (p[p->len].min || p[p->len].max) {  /* Repeated group starts without iterations */
+                        cnt = 0;
+                        op = BT_GROUP_LOOP;
+                    } else {
+                        BT_ENTER_GROUP();
+                    }
+                    continue;
+                } else if (p->type == P_CAPTURE_END) {
+                    if (BT_CAPTURED(ctx, p)) {
+                        ctx->matches[p->grp].len = s - ctx->matches[p->grp].s;
+                    }
+                    if (p->min || p->max) {
+                        op = BT_GROUP_END;
+                    } else {
+                        p++;
+                    }
+                    continue;
+                }
+
+                if (p->type == P_EMPTY || p[1].type == P_QM) {  /* No more patterns or 0 or 1 match */
+                    BT_ACCEPT(ctx, s);          /* Remember end of match */
+                } else if (p->min || p->max) {  /* Range of pattern, set for STAR and PLUS too */
+                    op = BT_RANGE;
+                    continue;
+                } else if (IS_SEQUENCE(p->type)) {  /* Exact char sequence, continue with rest of pattern */
+                    if ((n = match_char_sequence(ctx, p, s)) != NULL) {
+                        p++;
+                        s = n;
+                        continue;
+                    }
+                    result = 0;
+                } else if (p->type == P_END) {  /* End of string is required, anywhere in pattern */
+                    if (s != ctx->end) {
+                        result = 0;
+                    } else if (p[1].type == P_EMPTY) {
+                        BT_ACCEPT(ctx, s);
+                    } else {
+                        p++;                    /* Rest of pattern may only match empty string */
+                        continue;
+                    }
+                } else if (s < ctx->end && match_one_char(ctx, p, s)) {  /* Try to match single character */
+                    p++;                        /* Go to next pattern */
+                    s++;                        /* Go to next character */
+                    continue;
+                } else {
+                    result = 0;
+                }
+                op = BT_RETURN;
+                continue;
+            }
+            case BT_RANGE: {
+                cnt = 0;
+                if (!p->min && !p->poss && !greedy && CAN_MATCH_MORE(p) && !BT_VISITED(ctx, p + 1, s)) {   /* Pattern may be skipped entirely if minimum is 0 */
+                    BT_PUSH(BT_FRAME_SKIP);
+                    p++;
+                    op = BT_PATTERN;
+                } else {
+                    op = BT_RANGE_LOOP;
+                }
+                continue;
+            }
+            case BT_RANGE_LOOP: {
+                op = BT_RANGE_END;
+                if (RANGE_MORE(p, cnt) && s < ctx->end) {  /* Process entire string or while we didn't reach maximum */
+                    if (IS_ONE_CHAR(p) && (p->poss || greedy || !CAN_MATCH_MORE(p))) {    /* Rest of pattern is not tried between repetitions */
+                        k = (size_t)(ctx->end - s);
+                        if (p->max != RANGE_MAX && p->max - cnt < k) {
+                            k = p->max - cnt;
+                        }
+                        k = match_run(ctx, p, s, k);
+                        s += k;
+                        cnt += k;
+                        continue;
+                    } else if (IS_SEQUENCE(p->type)) {  /* Check for char sequence */
+                        if (match_char_sequence(ctx, p, s) == NULL) {
+                            continue;           /* Stop repetitions when failed */
+                        }
+                        s += p->len;            /* Increase character pointer for next entry by length of sequence */
+                    } else if (match_one_char(ctx, p, s)) {  /* Try to match single char only */
+                        s++;
+                    } else {
+                        continue;
+                    }
+                    cnt++;                      /* Count number of matches */
+                    op = BT_RANGE_LOOP;
+                    if (cnt >= p->min && !p->poss && !greedy && CAN_MATCH_MORE(p) && !BT_VISITED(ctx, p + 1, s)) {  /* Check if rest of pattern matches already */
+                        BT_PUSH(BT_FRAME_REPEAT);
+                        p++;
+                        op = BT_PATTERN;
+                    }
+                }
+                continue;
+            }
+            case BT_RANGE_END: {
+                result = 0;
+                if (cnt >= p->min && (cnt <= p->max || p->max == RANGE_MAX)) {  /* Now check how many entries we have */
+                    if (CAN_MATCH_MORE(p)) {    /* We are in valid range, rest of pattern decides */
+                        if (greedy && !p->poss && cnt > p->min) {
+                            BT_PUSH(BT_FRAME_LESS);
+                        }
+                        p++;
+                        op = BT_PATTERN;
+                        continue;
+                    } else if (p[1].type == P_CAPTURE_END && BT_CAPTURED(ctx, &p[1])) {   /* Close last group */
+                        ctx->matches[p[1].grp].len = s - ctx->matches[p[1].grp].s;
+                    }
+                    BT_ACCEPT(ctx, s);          /* Match ends with this pattern */
+                }
+                op = BT_RETURN;
+                continue;
+            }
+            case BT_GROUP_LOOP: {               /* Group start with number of iterations done */
+                if (!RANGE_MORE(p + p->len, cnt)) {    /* All iterations are matched */
+                    p += p->len + 1;
+                    op = BT_PATTERN;
+                    continue;
+                }
+                op = BT_GROUP_ITER;
+                if (cnt >= p[p->len].min) {
+                    if (p[p->len].poss || greedy || !CAN_MATCH_MORE((p + p->len))) {  /* Greedy, exit only when next iteration fails */
+                        BT_PUSH(BT_FRAME_EXIT);
+                    } else {                    /* Lazy, next iteration only when rest of pattern fails */
+                        BT_PUSH(BT_FRAME_MORE);
+                        p += p->len + 1;
+                        op = BT_PATTERN;
+                    }
+                }
+                continue;
+            }
+            case BT_GROUP_ITER: {
+                if (BT_ITER_ANY(p, cnt) && BT_VISITED(ctx, p + p->len + 1, s)) {  /* Iteration from this position failed before */
+                    result = 0;
+                    op = BT_RETURN;
+                    continue;
+                }
+                BT_PUSH_FRAME(BT_FRAME_ITER, p, s, cnt);
+                iter = top;                     /* Group end finds its iteration without stack scan */
+                greedy |= p[p->len].poss != 0;
+                BT_ENTER_GROUP();
+                op = BT_PATTERN;
+                continue;
+            }
+            case BT_GROUP_END: {                /* Group end, its iteration is the innermost open one */
+                k = iter - 1;                   /* Iteration frame */
+                f = &stack[k];
+                cnt = f->cnt + 1;
+                n = f->s;
+                iter = f->iter;
+                greedy = f->greedy;
+                if (p->poss) {                  /* Iteration is never given back, drop its frames with exit frame except undo of groups */
+                    top = bt_commit(stack, k - (cnt > p->min), top, iter);
+                } else if (!bt_has_choice(stack, k + 1, top)    /* Iteration cannot match differently, its frames are not needed */
+                           && (ctx->visit_s == NULL || !BT_ITER_ANY(f->p, f->cnt) || !bt_iter_free(stack, iter, n))) {  /* Unless its failure is marked in bitmap */
+                    /* Exit frame of greedy group at the end of pattern could only accept shorter match, when next exit accepts too */
+                    top = bt_commit(stack, k - (cnt > p->min && !CAN_MATCH_MORE(p) && ctx->m_req == NULL), top, iter);
+                }
+                if (s == n) {                   /* Empty iteration ends repetitions */
+                    p++;
+                    op = BT_PATTERN;
+                } else {
+                    p -= p->len;
+                    op = BT_GROUP_LOOP;
+                }
+                continue;
+            }
+            default: {
+                if (!top) {
+                    return result;
+                }
+                f = &stack[--top];
+                p = f->p;
+                s = f->s;
+                cnt = f->cnt;
+                iter = f->iter;
+                greedy = f->greedy;
+                if (f->type == BT_FRAME_UNDO) {
+                    if (!result) {              /* Group recorded by failed path */
+                        ctx->matches[p->grp].s = s;
+                        ctx->matches[p->grp].len = cnt;
+                    }
+                    continue;
+                } else if (f->type == BT_FRAME_ITER) {
+                    if (!result && BT_ITER_ANY(p, cnt)) {
+                        BT_VISIT(ctx, p + p->len + 1, s);   /* Iteration fails from this position */
+                    }
+                    continue;
+                }
+                if (!result) {
+                    REGEX_STAT(ctx, backtracks);
+                    if (f->type == BT_FRAME_SKIP || f->type == BT_FRAME_REPEAT || f->type == BT_FRAME_LESS) {
+                        BT_VISIT(ctx, p + 1, s);    /* Rest of pattern fails from this position */
+                    }
+                }
+                if (f->type == BT_FRAME_OR) {
+                    if (!result) {              /* Try next alternative */
+                        p += p->alt;
+                        if (p->alt) {
+                            BT_PUSH(BT_FRAME_OR);
+                        }
+                        p++;
+                        op = BT_PATTERN;
+                    }
+                } else if (f->type == BT_FRAME_SKIP || f->type == BT_FRAME_REPEAT) {
+                    if (!result) {              /* Rest of pattern matched already recorded its groups, it is not matched again */
+                        op = BT_RANGE_LOOP;
+                    }
+                } else if (f->type == BT_FRAME_LESS) {
+                    if (!result) {              /* Give back last repetition and try rest of pattern again */
+                        cnt--;
+                        s -= IS_SEQUENCE(p->type) ? p->len : 1;
+                        if (cnt > p->min) {
+                            BT_PUSH(BT_FRAME_LESS);
+                        }
+                        p++;
+                        op = BT_VISITED(ctx, p, s) ? BT_RETURN : BT_PATTERN;
+                    }
+                } else if (!result) {
+                    if (f->type == BT_FRAME_MORE) {
+                        op = BT_GROUP_ITER;
+                    } else {                    /* Next iteration failed, continue after group */
+                        p += p->len + 1;
+                        op = BT_PATTERN;
+                    }
                 }
+                continue;
+            }
+        }
+    }
+}
+
+/*
+ * Prefilters
+ *
+ * For unanchored patterns, set of bytes every match must start with is computed during compilation.
+ * Search loop jumps directly to candidate positions before matching engine is started.
+ *
+ * Longest literal every match must contain is searched for before matching,
+ * input without it is rejected without running any engine.
+ */
+
+/**
+ * \brief           Add possible first bytes of single pattern entry to set
+ * \param[in,out]   set: Set to add bytes to
+ * \param[in]       p: Pointer to pattern entry
+ */
+static void
+compile_first_atom(const regex_t* r, regex_class_t* set, const p_t* p) {
+    size_t i;
+    char ch;
+
+    switch (p->type) {
+        case P_DOT:
+            memset(set, 0xFF, sizeof(*set));
+            return;
+        case P_CHAR_CLASS:
+        case P_CHAR_CLASS_NOT:
+            for (i = 0; i < sizeof(set->set); i++) {
+                set->set[i] |= r->c[p->cls].set[i];
+            }
+            return;
+        case P_CHAR_SEQUENCE:
+        case P_CHAR_SEQUENCE_FOLD:
+            ch = p->str[0] == '\\' && p->len > 1 ? p->str[1] : p->str[0];
+            break;
+        default:
+            ch = p->ch;
+            break;
+    }
+    set->set[(uint8_t)ch >> 3] |= 1 << ((uint8_t)ch & 0x07);
+    if (p->type == P_CHAR_SEQUENCE_FOLD) {      /* Other case of letter may start too */
+        ch = FOLD_OTHER(ch);
+        set->set[(uint8_t)ch >> 3] |= 1 << ((uint8_t)ch & 0x07);
+    }
+}
+
+/**
+ * \brief           Get first entry of next pattern in compiled pattern set
+ * \param[in]       p: Pointer to any entry of current pattern
+ * \return          Pointer to first entry of next pattern
+ */
+static const p_t*
+next_pattern(const p_t* p) {
+    for (; p->type != P_EMPTY; p++) {}
+    return p + 1;
+}
+
+#define GRP_OPTIONAL(e)                         (!(e)->min && (e)->max) /*!< Group with end entry may be skipped entirely */
+
+/**
+ * \brief           Add first bytes of single iteration of group to set
+ * \param[in]       g: Pointer to group start entry
+ * \param[out]      set: Set to add bytes to
+ * \return          1 if any alternative of group may match empty string, 0 otherwise
+ */
+static uint8_t
+compile_first_group(const regex_t* r, const p_t* g, regex_class_t* set) {
+    const p_t* a, *q, *n;
+    uint8_t nullable = 0, empty;
+
+    for (a = g;; a = n) {
+        n = a->alt ? a + a->alt : g + g->len;   /* Entry after this alternative */
+        for (empty = 1, q = a + 1; empty && q < n;) {
+            if (q->type == P_CAPTURE_START) {
+                empty = compile_first_group(r, q, set) || GRP_OPTIONAL(q + q->len);
+                q += q->len + 1;
+            } else if (q->type == P_END) {  /* Alternative may match empty at the end, nothing follows */
+                q = n;
             } else {
-                p++;                            /* Previous check was failed, try with next after OR */
+                compile_first_atom(r, set, q);
+                empty = q->max > 0 && !q->min;
+                q++;
             }
-            continue;                           /* Ignore other execution and start over */
         }
+        nullable |= empty;
+        if (!a->alt) {
+            return nullable;
+        }
+    }
+}
 
-        if (p->type == P_CAPTURE_START) {
-            //printf("Capture start!\r\n");
-            //r->matches[r->m_len].s = s;
-            //r->matches[r->m_len].len = 0;
-            p++;
-            continue;
+/**
+ * \brief           Add first bytes of rest of compiled pattern to set
+ *
+ * Rest of pattern may start anywhere in pattern,
+ * group ends continue after group and repeated groups may also start next iteration.
+ *
+ * \param[in]       p: Pointer to first entry of rest of pattern
+ * \param[out]      set: Set to add bytes to
+ * \return          1 if rest of pattern may match empty string, 0 otherwise
+ */
+static uint8_t
+compile_first_pattern(const regex_t* r, const p_t* p, regex_class_t* set) {
+    if (p->type == P_BEGIN) {                   /* Anchor is not part of first set */
+        p++;
+    }
+    while (p->type != P_EMPTY) {
+        if (p->type == P_OR) {                  /* End of alternative, continue after group */
+            p += p->len;
         } else if (p->type == P_CAPTURE_END) {
-            //printf("Capture end!\r\n");
-            //r->matches[r->m_len].len = s - r->matches[r->m_len].s;
-            //r->m_len++;
+            if (p->max == RANGE_MAX || p->max > 1) {    /* Another iteration may follow */
+                compile_first_group(r, p - p->len, set);
+            }
+            p++;
+        } else if (p->type == P_CAPTURE_START) {
+            if (!compile_first_group(r, p, set) && !GRP_OPTIONAL(p + p->len)) {
+                return 0;
+            }
+            p += p->len + 1;
+        } else if (p->type == P_END) {
+            break;                              /* Empty match at the end is possible */
+        } else {
+            compile_first_atom(r, set, p);
+            if (!(p->max > 0 && !p->min)) {
+                return 0;
+            }
             p++;
-            continue;
         }
+    }
+    return 1;
+}
 
-        /**
-         * Check if there is no more patterns to match or
-         * we have pattern with question mark meaning 0 or 1 match
-         */
-        if (p->type == P_EMPTY || p[1].type == P_QM) {
-            result = 1;
-            ret = 1;
+/**
+ * \brief           Compute first byte set and literal prefix of compiled pattern
+ * \note            First set of pattern set is union of all patterns
+ */
+static void
+compile_first(regex_t* r) {
+    const p_t* p = r->p;
+    size_t i;
+
+    r->first_cnt = 0;
+    r->prefix = NULL;
+    r->prefix_len = 0;
+    memset(&r->first, 0x00, sizeof(r->first));
+    if (r->p_cnt == 1 && p->type == P_BEGIN) {  /* Anchored patterns are never scanned */
+        return;
+    }
+
+    /* Leading literal without escape characters is required prefix of every match */
+    for (; p->type == P_CAPTURE_START && !p->alt && !GRP_OPTIONAL(p + p->len); p++) {}
+    if (r->p_cnt == 1 && p->type == P_CHAR_SEQUENCE && !p->min && !p->max
+        && memchr(p->str, '\\', p->len) == NULL) {
+        r->prefix = p->str;
+        r->prefix_len = p->len;
+    }
+
+    /* Collect first bytes until entry which must match at least one character */
+    for (i = 0, p = r->p; i < r->p_cnt; i++, p = next_pattern(p)) {
+        if (compile_first_pattern(r, p, &r->first)) {  /* Empty string may match, every position is candidate */
+            return;
         }
-        /**
-         * Check if we have to make sure about range of pattern
-         * 
-         * It matches STAR and PLUS patterns, set by pattern compilation
-         */
-        else if (p->min || p->max) {
-            result = match_pattern_range(r, p, s);
-            ret = 1;
+    }
+    for (i = 0; i < 256; i++) {                 /* Count bytes and remember first few for vector search */
+        if (CLASS_HAS(&r->first, i)) {
+            if (r->first_cnt < sizeof(r->first_ch)) {
+                r->first_ch[r->first_cnt] = (char)i;
+            }
+            r->first_cnt++;
         }
-        /**
-         * Match exact char sequence between pattern and source string
-         */
-        else if (p[0].type == P_CHAR_SEQUENCE) {
-            result = match_char_sequence(r, p, s, 1);
-            ret = 1;
+    }
+    if (r->first_cnt == 256) {                  /* Any byte may start a match */
+        r->first_cnt = 0;
+    }
+}
+
+/**
+ * \brief           Find first position, where match may start
+ * \note            Used only when \ref regex_t.first_cnt is not `0`
+ * \param[in]       s: Position to start search at
+ * \param[in]       last: Last position match may start at, bytes after it are only read to compare prefix
+ * \param[in]       end: End of input
+ * \return          Candidate position or `NULL` if match is not possible
+ */
+static const char*
+prefilter_first(const regex_t* r, const char* s, const char* last, const char* end) {
+    size_t n;
+
+    if (r->prefix_len > 1) {                    /* Search for first byte of prefix and compare remaining */
+        while (s <= last && (size_t)(end - s) >= r->prefix_len) {
+            n = (size_t)(end - s) - r->prefix_len + 1;
+            n = (size_t)(last - s) + 1 < n ? (size_t)(last - s) + 1 : n;
+            if ((s = memchr(s, r->prefix[0], n)) == NULL) {
+                break;
+            } else if (!memcmp(s + 1, r->prefix + 1, r->prefix_len - 1)) {
+                return s;
+            }
+            s++;
         }
-        /**
-         * In case we have to end with specific match
-         * check if we are really at the end by checking if next pattern is end
-         * In this case simply check if source string is NULL
-         */
-        else if (p[0].type == P_END && p[1].type == P_EMPTY) {
-            result = !*s;
-            ret = 1;
+        return NULL;
+    }
+    if (last < end) {                           /* First byte of match is not searched after last start */
+        if (s > last) {
+            return NULL;
         }
-
-        /**
-         * Handle OR entries after we have known result
-         */
-        prev_result = 0;
-        if (ret) {                              /* Do we have to return status now? */
-            if (result) {                       /* In case we have valid result */
-                return result;                  /* Return it */
-            } else if (p[1].type == P_OR) {     /* Check if next one is OR of current */
-                p++;                            /* Go to next pattern to check */
-                continue;                       /* Ignore other */
+        end = last + 1;
+    }
+    if (r->first_cnt == 1) {                    /* Single possible byte */
+        return memchr(s, r->first_ch[0], (size_t)(end - s));
+    } else if (r->first_cnt <= sizeof(r->first_ch)) {
+#if REGEX_CFG_SIMD && defined(__SSE2__)
+        /* Compare 16 bytes at a time against every possible byte */
+        __m128i c0 = _mm_set1_epi8(r->first_ch[0]), c1 = _mm_set1_epi8(r->first_ch[1]);
+        __m128i c2 = _mm_set1_epi8(r->first_ch[r->first_cnt > 2 ? 2 : 1]);
+        __m128i c3 = _mm_set1_epi8(r->first_ch[r->first_cnt > 3 ? 3 : 1]);
+        __m128i d;
+        int m;
+        for (; end - s >= 16; s += 16) {
+            d = _mm_loadu_si128((const __m128i*)s);
+            m = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(d, c0), _mm_cmpeq_epi8(d, c1)),
+                                               _mm_or_si128(_mm_cmpeq_epi8(d, c2), _mm_cmpeq_epi8(d, c3))));
+            if (m) {
+                for (; !(m & 1); m >>= 1, s++) {}
+                return s;
             }
-            return result;                      /* Invalid result and no OR next = error */
         }
-        if (*s && match_one_char(r, p, s)) {    /* Try to match single character */
-            p++;                                /* Go to next pattern */
-            s++;                                /* Go to next character */
-            prev_result = 1;                    /* Set to valid result in case next one is OR */
-        } else {                                /* We failed with next char */
-            if (p[1].type == P_OR) {            /* In case next one is OR */
-                p++;                            /* Go to OR pattern */
-                continue;                       /* Ignore other execution */
+#elif REGEX_CFG_SIMD && defined(__aarch64__)
+        uint8x16_t c0 = vdupq_n_u8((uint8_t)r->first_ch[0]), c1 = vdupq_n_u8((uint8_t)r->first_ch[1]);
+        uint8x16_t c2 = vdupq_n_u8((uint8_t)r->first_ch[r->first_cnt > 2 ? 2 : 1]);
+        uint8x16_t c3 = vdupq_n_u8((uint8_t)r->first_ch[r->first_cnt > 3 ? 3 : 1]);
+        uint8x16_t d;
+        for (; end - s >= 16; s += 16) {
+            d = vld1q_u8((const uint8_t*)s);
+            if (vmaxvq_u8(vorrq_u8(vorrq_u8(vceqq_u8(d, c0), vceqq_u8(d, c1)), vorrq_u8(vceqq_u8(d, c2), vceqq_u8(d, c3))))) {
+                break;                          /* Exact position is found by scalar loop */
             }
-            break;                              /* Stop loop */
         }
-    } while (1);                                /* Infinite loop */
-    return 0;                                   /* No match at all found */
+#endif /* REGEX_CFG_SIMD */
+    }
+    for (; s < end; s++) {                      /* Test remaining bytes against set */
+        if (CLASS_HAS(&r->first, *s)) {
+            return s;
+        }
+    }
+    return NULL;
 }
 
+/**
+ * \brief           Find longest literal every match must contain and compute its skip table
+ *
+ * Distance of literal from match start is bounded, when only single characters
+ * and sequences with limited repetitions precede it.
+ */
 static void
-print_pattern(regex_t* p) {
-    size_t i = 0, len;
+compile_required(regex_t* r) {
+    const p_t* p, *req = NULL;
+    size_t i;
 
-    for (; p->p[i].type != P_EMPTY; i++) {
-        switch (p->p[i].type) {
-            case P_CHAR_CLASS:
-            case P_CHAR_CLASS_NOT:
-                printf("Char class: \"");
-                for (len = 0; len < p->p[i].len; len++) {
-                    printf("%c", p->p[i].str[len]);
-                }
-                printf("\"; Min: %d, Max: %d\r\n", (int)p->p[i].min, (int)p->p[i].max);
-                break;
-            case P_CHAR_SEQUENCE:
-                printf("Char sequence: \"");
-                for (len = 0; len < p->p[i].len; len++) {
-                    printf("%c", p->p[i].str[len]);
+    r->req = NULL;
+    r->req_len = 0;
+    r->req_dist = (size_t)-1;
+    r->req_fold = 0;
+    if (r->p_cnt > 1) {                         /* Literal of single pattern is not required by set */
+        return;
+    }
+    for (p = r->p; p->type != P_EMPTY; p++) {
+        if (p->type == P_CAPTURE_START && (p->alt || GRP_OPTIONAL(p + p->len))) {
+            p += p->len;                        /* Entries in alternation or optional group are not mandatory, skip group */
+            continue;
+        }
+        if (IS_SEQUENCE(p->type) && (p->min || !p->max) && memchr(p->str, '\\', p->len) == NULL
+            && (req == NULL || p->len > req->len)) {
+            req = p;
+        }
+    }
+    if (req == NULL || req->str == r->prefix) { /* Prefix search already checks leading literal */
+        return;
+    }
+
+    /* Prepare Boyer-Moore-Horspool skip table */
+    r->req = req->str;
+    r->req_len = req->len;
+    r->req_fold = req->type == P_CHAR_SEQUENCE_FOLD;
+    for (r->req_dist = 0, p = r->p; p != req; p++) {
+        if ((IS_ONE_CHAR(p) || IS_SEQUENCE(p->type)) && p->max != RANGE_MAX) {
+            r->req_dist += (IS_SEQUENCE(p->type) ? p->len : 1) * (p->min || p->max ? p->max : 1);
+        } else if (p->type != P_BEGIN) {        /* Groups and unlimited repetitions */
+            r->req_dist = (size_t)-1;
+            break;
+        }
+    }
+    memset(r->req_skip, r->req_len < 0xFF ? (int)r->req_len : 0xFF, sizeof(r->req_skip));
+    for (i = 0; i + 1 < r->req_len; i++) {      /* Shorter skip than possible is still valid */
+        r->req_skip[(uint8_t)r->req[i]] = (uint8_t)(r->req_len - 1 - i < 0xFF ? r->req_len - 1 - i : 0xFF);
+        if (r->req_fold) {                      /* Other case of letter skips the same */
+            r->req_skip[(uint8_t)FOLD_OTHER(r->req[i])] = r->req_skip[(uint8_t)r->req[i]];
+        }
+    }
+}
+
+/**
+ * \brief           Check if input contains literal required by every match
+ * \note            Used only when \ref regex_t.req_len is not `0`
+ * \param[in]       s: Start of input to search
+ * \param[in]       end: End of input
+ * \return          1 if literal was found and match is possible, 0 otherwise
+ */
+static uint8_t
+prefilter_required(const regex_t* r, const char* s, const char* end) {
+    size_t n = r->req_len, i;
+    char ch;
+
+    if (r->req_fold) {                          /* Case-insensitive literal is compared with fold table */
+        while ((size_t)(end - s) >= n) {
+            ch = s[n - 1];
+            if (FOLD(ch) == FOLD(r->req[n - 1])) {
+                for (i = 0; i + 1 < n && FOLD(s[i]) == FOLD(r->req[i]); i++) {}
+                if (i + 1 >= n) {
+                    return 1;
                 }
-                printf("\"; Min: %d, Max: %d\r\n", (int)p->p[i].min, (int)p->p[i].max);
-                break;
-            case P_CHAR:
-                printf("Char: %c; Min: %d, Max: %d\r\n", p->p[i].ch, (int)p->p[i].min, (int)p->p[i].max);
-                break;
-            case P_OR:
-                printf("OR\r\n");
-                break;
-            case P_CAPTURE_START:
-                printf("CAPTURE_START\r\n");
-                break;
-            case P_CAPTURE_END:
-                printf("CAPTURE_END\r\n");
-                break;
-            default:
-                break;
+            }
+            s += r->req_skip[(uint8_t)ch];
+        }
+        return 0;
+    }
+    while ((size_t)(end - s) >= n) {
+        ch = s[n - 1];                          /* Compare last character first */
+        if (ch == r->req[n - 1] && !memcmp(s, r->req, n - 1)) {
+            return 1;
         }
+        s += r->req_skip[(uint8_t)ch];
     }
+    return 0;
 }
 
 /*
- * Public API functions
+ * NFA (Pike VM) engine
+ *
+ * Compiled patterns are translated to simple instruction program once,
+ * when engine is selected. Character sequences are split to single characters,
+ * {min,max} repetitions are expanded and alternations are converted to split/jump instructions.
+ *
+ * Program is then simulated as set of active instructions,
+ * where each instruction is added at most once per input character,
+ * which guarantees O(pattern x input) matching time.
  */
 
 /**
- * \brief           Prepare and compile pattern before it can be used for matching
- * \param[in]       r: Pointer to empty \ref regex_t structure for matching
- * \param[in]       pattern: Pointer to pattern string
- * \param[in]       p: Pointer to array to hold patterns data to
- * \param[in]       p_len: Size of array for patterns
- * \return          1 on success, 0 otherwise
+ * \brief           List of NFA instruction types
  */
-uint8_t
-regex_prepare(regex_t* r, const char* pattern, regex_pattern_t* p, size_t p_len) {
-    size_t len;
+typedef enum {
+    NFA_CHAR,                                   /*!< Match exact character */
+    NFA_CHAR_FOLD,                              /*!< Match letter in any case, character is lowercase */
+    NFA_ANY,                                    /*!< Match any character */
+    NFA_CLASS,                                  /*!< Match compiled character class */
+    NFA_SPLIT,                                  /*!< Continue on both x and y instructions */
+    NFA_JMP,                                    /*!< Continue on x instruction */
+    NFA_END,                                    /*!< Continue only if at the end of input */
+    NFA_MATCH,                                  /*!< Pattern matched */
+} nfa_op_t;
 
-    r->p = p;                                   /* Save pointer to pattern array */
-    r->p_totlen = p_len;                        /* Save total length of array available to use */
-    r->p_len = 0;                               /* Reset number of currently used patterns */
+/**
+ * \brief           Single NFA instruction
+ */
+typedef struct {
+    uint8_t op;                                 /*!< Instruction type, member of \ref nfa_op_t */
+    char ch;                                    /*!< Character for \ref NFA_CHAR and \ref NFA_CHAR_FOLD instructions */
+    uint16_t cls;                               /*!< Class index for \ref NFA_CLASS instruction */
+    uint32_t x, y;                              /*!< Jump targets for \ref NFA_SPLIT and \ref NFA_JMP instructions */
+} nfa_inst_t;
 
-    if (!analyze_pattern(r, &pattern, &len)) {  /* Analyze pattern and make sure it is in correct format */
-        return 0;
-    }
+/**
+ * \brief           Sparse set of active NFA instructions
+ */
+typedef struct {
+    uint32_t* dense;                            /*!< List of active instructions in order of insertion */
+    uint32_t* sparse;                           /*!< Position of instruction in dense array */
+    size_t* start;                              /*!< Start offset of match for each instruction in dense array */
+    size_t len;                                 /*!< Number of active instructions */
+} nfa_list_t;
 
-    if (!compile_pattern(r, pattern, len)) {    /* Try to compile pattern */
-        return 0;
+#define NFA_ALIGN                               sizeof(size_t)
+#define NFA_ALIGN_UP(x)                         (((x) + NFA_ALIGN - 1) & ~(NFA_ALIGN - 1))
+#define NFA_NONE                                0xFFFFFFFFUL    /*!< No instruction */
+
+/**
+ * \brief           Write single instruction to program
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Instruction position
+ * \return          Position of next instruction
+ */
+static uint32_t
+nfa_put(nfa_inst_t* in, uint32_t pc, nfa_op_t op, char ch, uint16_t cls, uint32_t x, uint32_t y) {
+    if (in != NULL) {
+        in[pc].op = (uint8_t)op;
+        in[pc].ch = ch;
+        in[pc].cls = cls;
+        in[pc].x = x;
+        in[pc].y = y;
     }
-    return 1;
+    return pc + 1;
 }
 
 /**
- * \brief           Check if string and pattern matches, public API function
- * \param[in]       pattern: Pattern to check in string
- * \param[in]       str: Pointer to input string to make match on
- * \return          1 on match, 0 otherwise
+ * \brief           Write instructions matching pattern entry exactly once
+ * \param[in]       p: Pointer to pattern entry
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Position of first instruction
+ * \return          Position of next instruction
  */
-uint8_t
-regex_match(regex_t* r, const char* str, regex_match_t* matches, size_t m_len) {
-    p_t* p;
-    uint8_t anc;
+static uint32_t
+nfa_emit_atom(const p_t* p, nfa_inst_t* in, uint32_t pc) {
+    size_t i;
 
-    print_pattern(r);                           /* Print for debug purpose */
-    
-    p = r->p;                                   /* Set start pattern */
-    anc = p->type == P_BEGIN ? (p++, 1) : 0;    /* Check if string must start with anchor */
+    switch (p->type) {
+        case P_DOT:
+            return nfa_put(in, pc, NFA_ANY, 0, 0, 0, 0);
+        case P_CHAR_CLASS:
+        case P_CHAR_CLASS_NOT:
+            return nfa_put(in, pc, NFA_CLASS, 0, p->cls, 0, 0);
+        case P_CHAR_SEQUENCE:
+        case P_CHAR_SEQUENCE_FOLD:
+            for (i = 0; i < p->len; i++) {
+                if (p->str[i] == '\\' && i + 1 < p->len) {  /* Escaped character is matched directly */
+                    i++;
+                }
+                if (p->type == P_CHAR_SEQUENCE_FOLD && IS_C_ALPHA(p->str[i])) {
+                    pc = nfa_put(in, pc, NFA_CHAR_FOLD, (char)FOLD(p->str[i]), 0, 0, 0);
+                } else {
+                    pc = nfa_put(in, pc, NFA_CHAR, p->str[i], 0, 0, 0);
+                }
+            }
+            return pc;
+        default:                                /* Single character, also ^ and $ not on valid position */
+            return nfa_put(in, pc, NFA_CHAR, p->ch, 0, 0, 0);
+    }
+}
 
-    r->matches = matches;                       /* Set matching pointer */
-    r->m_totlen = m_len;                        /* Set total length of available matching */
-    r->m_len = 0;                               /* Reset number of used end matching arrays */
+static uint32_t nfa_emit_group(const p_t* g, nfa_inst_t* in, uint32_t pc);
 
-    do {
-        if (match_pattern(r, p, str, 0)) {      /* Simply process entire string, even if it is NULL */
+/**
+ * \brief           Write instructions matching pattern entry or entire group with {min,max} repetitions
+ * \note            Repetitions of group are set in its end entry
+ * \param[in]       p: Pointer to pattern entry or group start
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Position of first instruction
+ * \return          Position of next instruction
+ */
+static uint32_t
+nfa_emit_elem(const p_t* p, nfa_inst_t* in, uint32_t pc) {
+    const p_t* q = p->type == P_CAPTURE_START ? p + p->len : p;    /* Entry with repetitions */
+    uint32_t a, out, i;
+
+    if (!q->min && !q->max) {                   /* Entry without range is matched once */
+        return p == q ? nfa_emit_atom(p, in, pc) : nfa_emit_group(p, in, pc);
+    }
+    a = p == q ? nfa_emit_atom(p, NULL, 0) : nfa_emit_group(p, NULL, 0);    /* Get number of instructions for single repetition */
+    if (in == NULL) {                           /* Count without expanding repetitions */
+        return pc + q->min * a + (q->max == RANGE_MAX ? a + 2 : (q->max - q->min) * (a + 1));
+    }
+    for (i = 0; i < q->min; i++) {              /* Mandatory repetitions */
+        pc = p == q ? nfa_emit_atom(p, in, pc) : nfa_emit_group(p, in, pc);
+    }
+    if (q->max == RANGE_MAX) {                  /* Unlimited number of repetitions loops back */
+        pc = nfa_put(in, pc, NFA_SPLIT, 0, 0, pc + 1, pc + a + 2);
+        pc = p == q ? nfa_emit_atom(p, in, pc) : nfa_emit_group(p, in, pc);
+        pc = nfa_put(in, pc, NFA_JMP, 0, 0, pc - a - 1, 0);
+    } else {                                    /* Optional repetitions may skip to the end */
+        out = pc + (q->max - q->min) * (a + 1);
+        for (i = q->min; i < q->max; i++) {
+            pc = nfa_put(in, pc, NFA_SPLIT, 0, 0, pc + 1, out);
+            pc = p == q ? nfa_emit_atom(p, in, pc) : nfa_emit_group(p, in, pc);
+        }
+    }
+    return pc;
+}
+
+/**
+ * \brief           Write instructions for pattern entries up to given entry
+ * \param[in]       p: Pointer to first pattern entry
+ * \param[in]       stop: Pointer to entry after last one, group end or OR
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Position of first instruction
+ * \return          Position of next instruction
+ */
+static uint32_t
+nfa_emit_seq(const p_t* p, const p_t* stop, nfa_inst_t* in, uint32_t pc) {
+    for (; p < stop; p++) {
+        if (p->type == P_END) {
+            pc = nfa_put(in, pc, NFA_END, 0, 0, 0, 0);
+        } else {
+            pc = nfa_emit_elem(p, in, pc);
+            if (p->type == P_CAPTURE_START) {   /* Groups are not used, continue after group end */
+                p += p->len;
+            }
+        }
+    }
+    return pc;
+}
+
+/**
+ * \brief           Write instructions for alternatives of group matched once
+ * \param[in]       g: Pointer to group start
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Position of first instruction
+ * \return          Position of next instruction
+ */
+static uint32_t
+nfa_emit_group(const p_t* g, nfa_inst_t* in, uint32_t pc) {
+    const p_t* p;
+    uint32_t out;
+
+    out = in != NULL ? nfa_emit_group(g, NULL, pc) : 0; /* Get end of group first */
+    for (p = g; p->alt; p += p->alt) {          /* Each but last alternative jumps to the end */
+        pc = nfa_put(in, pc, NFA_SPLIT, 0, 0, pc + 1, in != NULL ? nfa_emit_seq(p + 1, p + p->alt, NULL, pc + 1) + 1 : 0);
+        pc = nfa_emit_seq(p + 1, p + p->alt, in, pc);
+        pc = nfa_put(in, pc, NFA_JMP, 0, 0, out, 0);
+    }
+    return nfa_emit_seq(p + 1, g + g->len, in, pc);
+}
+
+/**
+ * \brief           Translate single compiled pattern to NFA program
+ * \param[in]       p: Pointer to first entry of pattern
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[in]       pc: Position of first instruction
+ * \param[in]       id: Pattern index, stored to match instruction
+ * \return          Position of next instruction
+ */
+static uint32_t
+nfa_compile_pattern(const p_t* p, nfa_inst_t* in, uint32_t pc, uint32_t id) {
+    if (p->type == P_BEGIN) {                   /* Anchor is handled by search loop */
+        p++;
+    }
+    pc = nfa_emit_seq(p, next_pattern(p) - 1, in, pc);
+    return nfa_put(in, pc, NFA_MATCH, 0, 0, id, 0);
+}
+
+/**
+ * \brief           Translate compiled pattern to NFA program
+ *
+ * Program of pattern set starts with 2 chains of split instructions,
+ * first one to all patterns for the first input position,
+ * second one to patterns not anchored to the beginning for all other positions.
+ *
+ * \param[in]       in: Pointer to program or `NULL` when only counting instructions
+ * \param[out]      start: Output for instruction starting match after first input position,
+ *                      \ref NFA_NONE if pattern is anchored. Set to `NULL` if not used
+ * \return          Number of instructions in program
+ */
+static uint32_t
+nfa_compile(const regex_t* r, nfa_inst_t* in, uint32_t* start) {
+    const p_t* p;
+    uint32_t pc, a = 0, b, n = (uint32_t)r->p_cnt;
+    size_t i;
+
+    if (n == 1) {
+        if (start != NULL) {
+            *start = r->p->type == P_BEGIN ? NFA_NONE : 0;
+        }
+        return nfa_compile_pattern(r->p, in, 0, 0);
+    }
+    for (i = 0, p = r->p; i < n; i++, p = next_pattern(p)) {
+        a += p->type != P_BEGIN;                /* Count patterns for second chain */
+    }
+    if (start != NULL) {
+        *start = a ? n : NFA_NONE;
+    }
+    pc = n + a;                                 /* Patterns follow both chains */
+    for (i = 0, b = n, p = r->p; i < n; i++, p = next_pattern(p)) {
+        nfa_put(in, (uint32_t)i, i + 1 < n ? NFA_SPLIT : NFA_JMP, 0, 0, pc, (uint32_t)i + 1);
+        if (p->type != P_BEGIN) {
+            nfa_put(in, b, b + 1 < n + a ? NFA_SPLIT : NFA_JMP, 0, 0, pc, b + 1);
+            b++;
+        }
+        pc = nfa_compile_pattern(p, in, pc, (uint32_t)i);
+    }
+    return pc;
+}
+
+/**
+ * \brief           Estimate number of NFA instructions of pattern entries up to given entry
+ * \note            The same layout as \ref nfa_emit_seq, estimated from above
+ * \param[in]       p: Pointer to first pattern entry
+ * \param[in]       stop: Pointer to entry after last one
+ * \return          Number of instructions, at least \ref NFA_NONE if program does not fit
+ */
+static uint64_t
+nfa_estimate(const p_t* p, const p_t* stop) {
+    const p_t* q;
+    uint64_t n = 0, a;
+
+    for (; p < stop; p++) {
+        if (p->type == P_CAPTURE_START) {       /* Split and jump for each but last alternative */
+            for (a = 0, q = p; q->alt && a < NFA_NONE; q += q->alt) {
+                a += nfa_estimate(q + 1, q + q->alt) + 2;
+            }
+            a += nfa_estimate(q + 1, p + p->len);
+            p += p->len;                        /* Repetitions of group are in its end */
+        } else {
+            a = IS_SEQUENCE(p->type) ? p->len : 1;
+        }
+        if (a >= NFA_NONE) {
+            return NFA_NONE;
+        } else if (p->max == RANGE_MAX) {
+            a = (uint64_t)p->min * a + a + 2;
+        } else if (p->max) {
+            a = (uint64_t)p->max * (a + 1);
+        }
+        if ((n += a) >= NFA_NONE) {
+            return NFA_NONE;
+        }
+    }
+    return n;
+}
+
+/**
+ * \brief           Check if NFA program of compiled pattern has less than \ref NFA_NONE instructions
+ * \note            Size is estimated from above before program is counted, which expands {min,max} repetitions
+ * \return          1 if program fits, 0 otherwise
+ */
+static uint8_t
+nfa_fits(const regex_t* r) {
+    const p_t* p;
+    uint64_t n = 2 * (uint64_t)r->p_cnt;
+    size_t i;
+
+    for (i = 0, p = r->p; i < r->p_cnt && n < NFA_NONE; i++, p = next_pattern(p)) {
+        n += nfa_estimate(p, next_pattern(p) - 1) + 1;  /* Match instruction */
+    }
+    return n < NFA_NONE;
+}
+
+/**
+ * \brief           Add instruction to active list if not there yet
+ * \param[in]       l: List to add instruction to
+ * \param[in]       pc: Instruction position
+ */
+static void
+nfa_add(nfa_list_t* l, uint32_t pc) {
+    if (l->sparse[pc] >= l->len || l->dense[l->sparse[pc]] != pc) {
+        l->sparse[pc] = (uint32_t)l->len;
+        l->dense[l->len++] = pc;
+    }
+}
+
+/**
+ * \brief           Check if instruction is in list
+ * \param[in]       l: List to check
+ * \param[in]       pc: Instruction position
+ * \return          1 if in list, 0 otherwise
+ */
+static uint8_t
+nfa_has(const nfa_list_t* l, uint32_t pc) {
+    return l->sparse[pc] < l->len && l->dense[l->sparse[pc]] == pc;
+}
+
+/**
+ * \brief           Get size of NFA state lists
+ * \param[in]       n: Number of instructions in program
+ * \return          Size in units of bytes
+ */
+static size_t
+nfa_lists_mem(size_t n) {
+    /* Start offsets for 2 lists, 2 sparse sets with 2 arrays each and closure stack */
+    return 2 * n * sizeof(size_t) + (5 * n + 1) * sizeof(uint32_t);
+}
+
+/**
+ * \brief           Get size of NFA program and state lists
+ * \param[in]       n: Number of instructions in program
+ * \return          Size in units of bytes
+ */
+static size_t
+nfa_mem(size_t n) {
+    return NFA_ALIGN_UP(n * sizeof(nfa_inst_t)) + NFA_ALIGN_UP(nfa_lists_mem(n));
+}
+
+/**
+ * \brief           Get size of backtracking stack, which compiled pattern can never exhaust
+ * \return          Size in units of bytes
+ */
+static size_t
+bt_mem(const regex_t* r) {
+    return NFA_ALIGN_UP(BT_FRAMES(r->p_len) * sizeof(bt_frame_t));
+}
+
+/**
+ * \brief           Set up both state lists in memory
+ * \param[in]       mem: Aligned memory of \ref nfa_lists_mem size
+ * \param[in]       n: Number of instructions in program
+ * \param[out]      l: Array of 2 lists to set up
+ * \return          Pointer to closure stack
+ */
+static uint32_t*
+nfa_lists_at(void* mem, size_t n, nfa_list_t* l) {
+    l[0].start = (size_t*)mem;
+    l[1].start = l[0].start + n;
+    l[0].dense = (uint32_t*)(l[1].start + n);
+    l[0].sparse = l[0].dense + n;
+    l[1].dense = l[0].sparse + n;
+    l[1].sparse = l[1].dense + n;
+    l[0].len = l[1].len = 0;
+    return l[1].sparse + n;
+}
+
+/**
+ * \brief           Set up both state lists in context memory
+ * \param[out]      l: Array of 2 lists to set up
+ * \return          Pointer to closure stack
+ */
+static uint32_t*
+nfa_lists(regex_match_ctx_t* ctx, nfa_list_t* l) {
+    return nfa_lists_at(ctx->lists, ctx->r->nfa_len, l);
+}
+
+/**
+ * \brief           Add instruction and all instructions reachable from it without consuming input
+ *
+ * Instructions are added in depth-first order of priority,
+ * instruction already in list keeps its earlier start position.
+ *
+ * \param[in]       l: List to add instructions to
+ * \param[in]       stack: Closure stack with at least `nfa_len + 1` entries
+ * \param[in]       pc: Instruction position
+ * \param[in]       start: Start offset of match this thread belongs to
+ * \param[in]       end: Set to 1 if list belongs to position at the end of input
+ */
+static void
+nfa_add_thread(const regex_t* r, nfa_list_t* l, uint32_t* stack, uint32_t pc, size_t start, uint8_t end) {
+    const nfa_inst_t* in = r->nfa;
+    size_t sp = 0;
+
+    stack[sp++] = pc;
+    while (sp) {
+        pc = stack[--sp];
+        if (nfa_has(l, pc)) {
+            continue;
+        }
+        l->start[l->len] = start;
+        nfa_add(l, pc);
+        switch (in[pc].op) {
+            case NFA_SPLIT:                     /* First target has priority and is processed first */
+                stack[sp++] = in[pc].y;
+                stack[sp++] = in[pc].x;
+                break;
+            case NFA_JMP:
+                stack[sp++] = in[pc].x;
+                break;
+            case NFA_END:
+                if (end) {
+                    stack[sp++] = pc + 1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * \brief           Match input string with NFA engine
+ *
+ * Threads are kept in order of their start position.
+ * When span is requested, leftmost match is reported and it is extended as long as possible.
+ *
+ * \param[in]       str: Pointer to input string to match, end is set in \ref regex_match_ctx_t
+ * \param[out]      span: Output for start and length of match. Set to `NULL` if only result is needed
+ * \return          1 on match, 0 otherwise
+ */
+static uint8_t
+nfa_match(regex_match_ctx_t* ctx, const char* str, regex_match_t* span) {
+    const regex_t* r = ctx->r;
+    const nfa_inst_t* in = r->nfa, *ip;
+    nfa_list_t lists[2], *cl = &lists[0], *nl = &lists[1], *tmp;
+    const char* s;
+    uint32_t pc, *stack;
+    size_t i, start, m_start = 0;
+    uint8_t anc, found = 0;
+
+    stack = nfa_lists(ctx, lists);
+    anc = r->p->type == P_BEGIN || MODE_ANCHORED(ctx);
+
+    for (s = str;; s++) {
+        if (!anc && !cl->len && r->first_cnt) { /* Skip to next possible start of match */
+            if ((s = prefilter_first(r, s, ctx->m_last, ctx->end)) == NULL) {
+                return 0;
+            }
+        }
+        if (!found && (!anc || s == str) && s <= ctx->m_last) { /* Start new match on every position if not anchored */
+            nfa_add_thread(r, cl, stack, 0, (size_t)(s - str), s == ctx->end);
+        }
+
+        /* Process active threads in order of priority */
+        for (i = 0; i < cl->len; i++) {
+            pc = cl->dense[i];
+            start = cl->start[i];
+            if (found && start > m_start) {   /* Threads starting after found match are not needed */
+                break;
+            }
+            ip = &in[pc];
+            switch (ip->op) {
+                case NFA_CHAR:
+                    if (s < ctx->end && *s == ip->ch) {
+                        nfa_add_thread(r, nl, stack, pc + 1, start, s + 1 == ctx->end);
+                    }
+                    break;
+                case NFA_CHAR_FOLD:
+                    if (s < ctx->end && FOLD(*s) == (uint8_t)ip->ch) {
+                        nfa_add_thread(r, nl, stack, pc + 1, start, s + 1 == ctx->end);
+                    }
+                    break;
+                case NFA_ANY:
+                    if (s < ctx->end) {
+                        nfa_add_thread(r, nl, stack, pc + 1, start, s + 1 == ctx->end);
+                    }
+                    break;
+                case NFA_CLASS:
+                    if (s < ctx->end && CLASS_HAS(&r->c[ip->cls], *s)) {
+                        nfa_add_thread(r, nl, stack, pc + 1, start, s + 1 == ctx->end);
+                    }
+                    break;
+                case NFA_MATCH:
+                    if (ctx->m_req != NULL && s != ctx->m_req) {    /* Match must end on required position */
+                        break;
+                    } else if (span == NULL) {  /* Only result is needed */
+                        return 1;
+                    }
+                    found = 1;                  /* Remember match, longer one may follow */
+                    m_start = start;
+                    span->s = str + start;
+                    span->len = (size_t)(s - str) - start;
+                    break;
+                default:                        /* Other instructions were followed when added */
+                    break;
+            }
+        }
+        if (s == ctx->end || (!nl->len && (anc || found || s >= ctx->m_last))) { /* End of input or no more active threads */
+            break;
+        }
+        tmp = cl;                               /* Swap lists for next character */
+        cl = nl;
+        nl = tmp;
+        nl->len = 0;
+    }
+    return found;
+}
+
+/**
+ * \brief           Find first match instruction in list of threads
+ * \param[in]       l: List of threads
+ * \param[in]       i: Index to start search at
+ * \return          Index of thread at match instruction, `l->len` if there is none
+ */
+static size_t
+nfa_list_match(const regex_t* r, const nfa_list_t* l, size_t i) {
+    const nfa_inst_t* in = r->nfa;
+
+    for (; i < l->len && in[l->dense[i]].op != NFA_MATCH; i++) {}
+    return i;
+}
+
+/**
+ * \brief           Drop threads which started at or before offset, keep order of the rest
+ * \param[in]       l: List of threads, in order of start
+ * \param[in]       start: Start offset of last dropped threads
+ */
+static void
+nfa_list_drop(nfa_list_t* l, size_t start) {
+    size_t i, k;
+
+    for (i = 0, k = 0; i < l->len; i++) {
+        if (l->start[i] > start) {
+            l->dense[k] = l->dense[i];
+            l->start[k] = l->start[i];
+            l->sparse[l->dense[k]] = (uint32_t)k;
+            k++;
+        }
+    }
+    l->len = k;
+}
+
+/**
+ * \brief           Report pending stream matches from the oldest one
+ * \param[in]       st: Stream context
+ * \param[in]       cnt: Number of matches to report
+ * \return          Number of reported matches
+ */
+static size_t
+nfa_stream_report(regex_stream_t* st, size_t cnt) {
+    size_t k;
+
+    for (k = 0; k < cnt; k++) {
+        st->fn(st->arg, st->pend[2 * k], st->pend[2 * k + 1] - st->pend[2 * k]);
+    }
+    st->pend_len -= cnt;
+    memmove(st->pend, &st->pend[2 * cnt], st->pend_len * 2 * sizeof(*st->pend));
+    return cnt;
+}
+
+/**
+ * \brief           Add match ending at current stream position to pending matches
+ *
+ * Pending matches are in order of start and do not overlap.
+ * Match with the same start as pending one is its longer version and replaces it,
+ * pending matches with later start overlap with new match and are dropped.
+ * When there is no space left, oldest pending match is reported without waiting for threads started before it.
+ *
+ * \param[in]       st: Stream context
+ * \param[in]       l: Current list of threads
+ * \param[in]       start: Absolute stream offset of match start
+ * \return          Number of reported matches
+ */
+static size_t
+nfa_stream_pend(regex_stream_t* st, nfa_list_t* l, size_t start) {
+    size_t k, cnt = 0;
+
+    for (k = 0; k < st->pend_len && st->pend[2 * k] < start; k++) {}
+    if (k == REGEX_CFG_STREAM_PENDING) {
+        nfa_list_drop(l, st->pend[0]);
+        cnt = nfa_stream_report(st, 1);
+        k--;
+    }
+    st->pend[2 * k] = start;
+    st->pend[2 * k + 1] = st->off;
+    st->pend_len = k + 1;
+    return cnt;
+}
+
+/**
+ * \brief           Process single stream position with NFA threads
+ *
+ * Threads are kept in order of their start, as in \ref nfa_match.
+ * Leftmost match ending at current position becomes pending, threads started inside of it are dropped.
+ * Pending match is reported when no thread started before or with it is alive anymore,
+ * which gives the same matches as \ref regex_find_next loop over entire stream.
+ * End of input is not known until the end of stream, end assertions are followed only then.
+ *
+ * \param[in]       st: Stream context
+ * \param[in]       l: Both state lists, current one is at `st->cur` index
+ * \param[in]       stack: Closure stack
+ * \param[in]       s: Pointer to input byte at current position, `NULL` at the end of stream
+ * \return          Number of reported matches
+ */
+static size_t
+nfa_stream_step(regex_stream_t* st, nfa_list_t* l, uint32_t* stack, const char* s) {
+    const regex_t* r = st->r;
+    const nfa_inst_t* in = r->nfa, *ip;
+    nfa_list_t* cl = &l[st->cur], *nl = &l[!st->cur];
+    size_t i, k, m_start, cnt = 0;
+    uint32_t pc;
+    uint8_t found, empty = 0;
+
+    if (s == NULL) {                            /* End assertions pass only now, closure is redone in order of start */
+        nl->len = 0;
+        for (i = 0; i < cl->len; i++) {
+            nfa_add_thread(r, nl, stack, cl->dense[i], cl->start[i], 1);
+        }
+        st->cur = !st->cur;
+        cl = &l[st->cur];
+        nl = &l[!st->cur];
+    }
+    if ((found = (k = nfa_list_match(r, cl, 0)) < cl->len) != 0) {
+        m_start = cl->start[k];
+        cnt += nfa_stream_pend(st, cl, m_start);
+        for (i = 0; i < cl->len && cl->start[i] <= m_start; i++) {}   /* Threads started inside of match cannot match */
+        cl->len = i;
+    }
+    if (!st->off || r->nfa_start != NFA_NONE) { /* Start new match on every position if not anchored */
+        pc = st->off ? r->nfa_start : 0;
+        if (found) {                            /* Match instruction is taken by earlier thread, check empty match alone */
+            nl->len = 0;
+            nfa_add_thread(r, nl, stack, pc, st->off, s == NULL);
+            empty = nfa_list_match(r, nl, 0) < nl->len;
+        }
+        i = cl->len;
+        nfa_add_thread(r, cl, stack, pc, st->off, s == NULL);
+        if (empty || nfa_list_match(r, cl, i) < cl->len) {
+            cnt += nfa_stream_pend(st, cl, st->off);
+        }
+    }
+
+    /* Advance threads to next position, none is alive at the end of stream */
+    nl->len = 0;
+    for (i = 0; s != NULL && i < cl->len; i++) {
+        ip = &in[cl->dense[i]];
+        if ((ip->op == NFA_CHAR && ip->ch == *s) || ip->op == NFA_ANY
+            || (ip->op == NFA_CHAR_FOLD && (uint8_t)ip->ch == FOLD(*s)) || (ip->op == NFA_CLASS && CLASS_HAS(&r->c[ip->cls], *s))) {
+            nfa_add_thread(r, nl, stack, cl->dense[i] + 1, cl->start[i], 0);
+        }
+    }
+    st->cur = !st->cur;                         /* Next list becomes current one */
+    st->off++;
+
+    /* Pending matches are final when threads started before or with them are gone */
+    for (k = 0; k < st->pend_len && (!nl->len || st->pend[2 * k] < nl->start[0]); k++) {}
+    return cnt + (k ? nfa_stream_report(st, k) : 0);
+}
+
+/*
+ * Lazy DFA engine
+ *
+ * Each distinct set of active NFA instructions becomes DFA state with transition row for all input bytes.
+ * States and transitions are built on demand while matching and are kept in cache memory,
+ * which follows NFA memory. When cache is full, it is flushed and building starts over.
+ */
+
+#define DFA_HASH_SIZE                           64
+#define DFA_MATCH                               0x01    /*!< State set contains match instruction */
+#define DFA_MATCH_END                           0x02    /*!< State set matches when at the end of input */
+
+/**
+ * \brief           Single DFA state in cache memory
+ */
+typedef struct {
+    uint32_t next[256];                         /*!< Cache offset of next state + 1 for each input byte, 0 if not built yet */
+    uint32_t chain;                             /*!< Cache offset of next state in hash bucket + 1, 0 if last */
+    uint32_t hash;                              /*!< Hash of instruction set */
+    uint32_t flags;                             /*!< State flags, DFA_MATCH and DFA_MATCH_END */
+    uint32_t len;                               /*!< Number of instructions in set */
+    uint32_t pc[1];                             /*!< Sorted set of instructions, actual length is len */
+} dfa_state_t;
+
+#define DFA_STATE_WORDS(len)                    ((offsetof(dfa_state_t, pc) / sizeof(uint32_t)) + (len))
+#define DFA_STATE(ctx, off)                     ((dfa_state_t*)&(ctx)->dfa[(off)])
+
+/**
+ * \brief           Add all instructions reachable without consuming input
+ * \param[in]       l: List with seed instructions, reachable ones are appended
+ * \param[in]       end: Set to 1 to follow end assertions, at the end of input
+ */
+static void
+nfa_closure(const regex_t* r, nfa_list_t* l, uint8_t end) {
+    const nfa_inst_t* in = r->nfa;
+    size_t i;
+
+    for (i = 0; i < l->len; i++) {
+        if (in[l->dense[i]].op == NFA_SPLIT) {
+            nfa_add(l, in[l->dense[i]].x);
+            nfa_add(l, in[l->dense[i]].y);
+        } else if (in[l->dense[i]].op == NFA_JMP) {
+            nfa_add(l, in[l->dense[i]].x);
+        } else if (end && in[l->dense[i]].op == NFA_END) {
+            nfa_add(l, l->dense[i] + 1);
+        }
+    }
+}
+
+/**
+ * \brief           Remove all states from cache
+ */
+static void
+dfa_flush(regex_match_ctx_t* ctx) {
+    memset(ctx->dfa, 0x00, DFA_HASH_SIZE * sizeof(uint32_t));
+    ctx->dfa_used = DFA_HASH_SIZE;              /* Hash buckets are at the beginning */
+    ctx->dfa_start = 0;
+    ctx->dfa_idle = 0;
+    ctx->dfa_flushes++;
+    REGEX_STAT(ctx, dfa_flushes);
+}
+
+/**
+ * \brief           Find or create DFA state for set of instructions
+ * \note            Cache is flushed if there is no memory for new state
+ * \param[in]       l: List of seed instructions, modified by this function
+ * \param[in]       tmp: Temporary list for computed set
+ * \return          Cache offset of state + 1
+ */
+static uint32_t
+dfa_state(regex_match_ctx_t* ctx, nfa_list_t* l, nfa_list_t* tmp) {
+    const regex_t* r = ctx->r;
+    const nfa_inst_t* in = r->nfa;
+    dfa_state_t* st;
+    uint32_t pc, hash = 2166136261UL, off, flags = 0;
+    size_t i;
+
+    /*
+     * Keep only instructions which consume input or match,
+     * in order of program to get the same state for the same set
+     */
+    nfa_closure(r, l, 0);
+    tmp->len = 0;
+    for (pc = 0; pc < r->nfa_len; pc++) {
+        if (nfa_has(l, pc) && in[pc].op != NFA_SPLIT && in[pc].op != NFA_JMP) {
+            tmp->dense[tmp->len++] = pc;
+            hash = (hash ^ pc) * 16777619UL;
+        }
+    }
+
+    /* Check for existing state */
+    for (off = ctx->dfa[hash % DFA_HASH_SIZE]; off; off = st->chain) {
+        st = DFA_STATE(ctx, off - 1);
+        if (st->hash == hash && st->len == tmp->len
+            && !memcmp(st->pc, tmp->dense, tmp->len * sizeof(uint32_t))) {
+            return off;
+        }
+    }
+
+    /* Check match flags, end assertion is followed only for match at the end of input */
+    l->len = 0;
+    for (i = 0; i < tmp->len; i++) {
+        if (in[tmp->dense[i]].op == NFA_MATCH) {
+            flags |= DFA_MATCH;
+        } else if (in[tmp->dense[i]].op == NFA_END) {
+            nfa_add(l, tmp->dense[i] + 1);
+        }
+    }
+    nfa_closure(r, l, 1);
+    for (i = 0; i < l->len; i++) {
+        if (in[l->dense[i]].op == NFA_MATCH) {
+            flags |= DFA_MATCH_END;
+        }
+    }
+
+    /* Create new state, cache is always big enough for at least 2 states */
+    if (ctx->dfa_used + DFA_STATE_WORDS(tmp->len) > ctx->dfa_len) {
+        dfa_flush(ctx);                         /* Computed set does not depend on cache */
+    }
+    off = (uint32_t)ctx->dfa_used;
+    ctx->dfa_used += DFA_STATE_WORDS(tmp->len);
+    st = DFA_STATE(ctx, off);
+    memset(st->next, 0x00, sizeof(st->next));
+    st->hash = hash;
+    st->flags = flags | (flags & DFA_MATCH ? DFA_MATCH_END : 0);
+    st->len = (uint32_t)tmp->len;
+    memcpy(st->pc, tmp->dense, tmp->len * sizeof(uint32_t));
+    st->chain = ctx->dfa[hash % DFA_HASH_SIZE]; /* Insert to hash bucket */
+    ctx->dfa[hash % DFA_HASH_SIZE] = off + 1;
+    return off + 1;
+}
+
+/**
+ * \brief           Compute next DFA state on input character
+ * \param[in]       off: Cache offset of current state + 1
+ * \param[in]       ch: Input character
+ * \param[in]       seed: Set to 1 to start new match on next position.
+ *                      Transition without new match is not cached, it is only used after last start of limited search
+ * \return          Cache offset of next state + 1
+ */
+static uint32_t
+dfa_next(regex_match_ctx_t* ctx, uint32_t off, char ch, uint8_t seed) {
+    const regex_t* r = ctx->r;
+    const nfa_inst_t* in = r->nfa, *ip;
+    nfa_list_t l[2];
+    dfa_state_t* st = DFA_STATE(ctx, off - 1);
+    uint32_t next, flushes = ctx->dfa_flushes;
+    size_t i;
+
+    nfa_lists(ctx, l);
+    for (i = 0; i < st->len; i++) {             /* Step all consuming instructions */
+        ip = &in[st->pc[i]];
+        if ((ip->op == NFA_CHAR && ip->ch == ch) || ip->op == NFA_ANY
+            || (ip->op == NFA_CHAR_FOLD && (uint8_t)ip->ch == FOLD(ch)) || (ip->op == NFA_CLASS && CLASS_HAS(&r->c[ip->cls], ch))) {
+            nfa_add(&l[0], st->pc[i] + 1);
+        }
+    }
+    if (seed && r->nfa_start != NFA_NONE) {     /* New match may start on every position */
+        nfa_add(&l[0], r->nfa_start);
+    }
+    next = dfa_state(ctx, &l[0], &l[1]);
+    if (seed && flushes == ctx->dfa_flushes) {  /* Current state is still valid if cache was not flushed */
+        st->next[(uint8_t)ch] = next;           /* Cache transition */
+    }
+    return next;
+}
+
+/**
+ * \brief           Match input string with lazy DFA engine
+ *
+ * After last start position of limited search, states are computed without new matches, until match or no active instruction.
+ *
+ * \param[in]       str: Pointer to input string to match, end is set in \ref regex_match_ctx_t
+ * \return          1 on match, 0 otherwise
+ */
+static uint8_t
+dfa_match(regex_match_ctx_t* ctx, const char* str) {
+    const regex_t* r = ctx->r;
+    nfa_list_t l[2];
+    const dfa_state_t* st;
+    const char* s;
+    uint32_t off, next;
+    uint8_t anc = r->p->type == P_BEGIN;
+
+    if (!ctx->dfa_start) {                      /* Build start state */
+        nfa_lists(ctx, l);
+        nfa_add(&l[0], 0);
+        ctx->dfa_start = dfa_state(ctx, &l[0], &l[1]);
+    }
+    off = ctx->dfa_start;
+    for (s = str; s < ctx->end; s++) {
+        if (off == ctx->dfa_start && !anc && r->first_cnt && s <= ctx->m_last) { /* Skip to next possible start of match */
+            if ((s = prefilter_first(r, s, ctx->m_last, ctx->end)) == NULL) {
+                return 0;
+            }
+        }
+        st = DFA_STATE(ctx, off - 1);
+        if ((st->flags & DFA_MATCH) && ctx->m_req == NULL) {   /* First match state is enough */
+            return 1;
+        } else if ((anc || s > ctx->m_last) && !st->len) { /* No more active instructions */
+            return 0;
+        }
+        if (s >= ctx->m_last) {                 /* No new match after last start position */
+            off = dfa_next(ctx, off, *s, 0);
+        } else if ((next = st->next[(uint8_t)*s]) != 0) { /* Transition is cached */
+            REGEX_STAT(ctx, dfa_hits);
+            off = next;
+        } else {
+            REGEX_STAT(ctx, dfa_misses);
+            off = dfa_next(ctx, off, *s, 1);
+        }
+    }
+    return (DFA_STATE(ctx, off - 1)->flags & DFA_MATCH_END) != 0;
+}
+
+/**
+ * \brief           Mark pattern of pattern set as matched
+ * \param[in,out]   ids: Bit array of matched patterns
+ * \param[in]       id: Pattern index
+ * \return          1 if pattern was not marked before, 0 otherwise
+ */
+static uint8_t
+set_mark(uint8_t* ids, uint32_t id) {
+    if (ids[id >> 3] & (1U << (id & 0x07))) {
+        return 0;
+    }
+    ids[id >> 3] |= (uint8_t)(1U << (id & 0x07));
+    return 1;
+}
+
+/**
+ * \brief           Match input string against all patterns of set with NFA engine
+ * \param[in]       str: Pointer to input string to match, end is set in \ref regex_match_ctx_t
+ * \param[out]      ids: Bit array to mark matched patterns in, cleared by caller
+ * \return          Number of matched patterns
+ */
+static size_t
+nfa_match_set(regex_match_ctx_t* ctx, const char* str, uint8_t* ids) {
+    const regex_t* r = ctx->r;
+    const nfa_inst_t* in = r->nfa, *ip;
+    nfa_list_t lists[2], *cl = &lists[0], *nl = &lists[1], *tmp;
+    const char* s;
+    size_t i, found = 0;
+
+    nfa_lists(ctx, lists);
+    for (s = str;; s++) {
+        if (!cl->len && r->first_cnt) {         /* Skip to next possible start of match */
+            if ((s = prefilter_first(r, s, ctx->m_last, ctx->end)) == NULL) {
+                return found;
+            }
+        }
+        if (s == str) {                         /* All patterns may start on first position */
+            nfa_add(cl, 0);
+        } else if (r->nfa_start != NFA_NONE) {
+            nfa_add(cl, r->nfa_start);
+        }
+
+        /* Matched patterns keep their threads, order of instructions is not important */
+        for (i = 0; i < cl->len; i++) {
+            ip = &in[cl->dense[i]];
+            switch (ip->op) {
+                case NFA_CHAR:
+                    if (s < ctx->end && *s == ip->ch) {
+                        nfa_add(nl, cl->dense[i] + 1);
+                    }
+                    break;
+                case NFA_CHAR_FOLD:
+                    if (s < ctx->end && FOLD(*s) == (uint8_t)ip->ch) {
+                        nfa_add(nl, cl->dense[i] + 1);
+                    }
+                    break;
+                case NFA_ANY:
+                    if (s < ctx->end) {
+                        nfa_add(nl, cl->dense[i] + 1);
+                    }
+                    break;
+                case NFA_CLASS:
+                    if (s < ctx->end && CLASS_HAS(&r->c[ip->cls], *s)) {
+                        nfa_add(nl, cl->dense[i] + 1);
+                    }
+                    break;
+                case NFA_SPLIT:
+                    nfa_add(cl, ip->x);
+                    nfa_add(cl, ip->y);
+                    break;
+                case NFA_JMP:
+                    nfa_add(cl, ip->x);
+                    break;
+                case NFA_END:
+                    if (s == ctx->end) {
+                        nfa_add(cl, cl->dense[i] + 1);
+                    }
+                    break;
+                case NFA_MATCH:
+                    if (set_mark(ids, ip->x) && ++found == r->p_cnt) {
+                        return found;           /* All patterns matched */
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        if (s == ctx->end || (r->nfa_start == NFA_NONE && !nl->len)) { /* End of input or no more active threads */
+            break;
+        }
+        tmp = cl;                               /* Swap lists for next character */
+        cl = nl;
+        nl = tmp;
+        nl->len = 0;
+    }
+    return found;
+}
+
+/**
+ * \brief           Mark patterns matched by set of instructions
+ * \param[in]       pc: Instructions of DFA state or its closure at the end of input
+ * \param[in]       len: Number of instructions
+ * \param[in,out]   ids: Bit array of matched patterns
+ * \return          Number of newly marked patterns
+ */
+static size_t
+dfa_mark(const regex_t* r, const uint32_t* pc, size_t len, uint8_t* ids) {
+    const nfa_inst_t* in = r->nfa;
+    size_t i, found = 0;
+
+    for (i = 0; i < len; i++) {
+        if (in[pc[i]].op == NFA_MATCH) {
+            found += set_mark(ids, in[pc[i]].x);
+        }
+    }
+    return found;
+}
+
+/**
+ * \brief           Match input string against all patterns of set with lazy DFA engine
+ * \param[in]       str: Pointer to input string to match, end is set in \ref regex_match_ctx_t
+ * \param[out]      ids: Bit array to mark matched patterns in, cleared by caller
+ * \return          Number of matched patterns
+ */
+static size_t
+dfa_match_set(regex_match_ctx_t* ctx, const char* str, uint8_t* ids) {
+    const regex_t* r = ctx->r;
+    nfa_list_t l[2];
+    const dfa_state_t* st;
+    const char* s;
+    uint32_t off, next;
+    size_t i, found = 0;
+
+    /* Build start state and state without active match, building one may flush the other */
+    while (!ctx->dfa_start || (r->nfa_start != NFA_NONE && !ctx->dfa_idle)) {
+        nfa_lists(ctx, l);
+        if (!ctx->dfa_start) {
+            nfa_add(&l[0], 0);
+            ctx->dfa_start = dfa_state(ctx, &l[0], &l[1]);
+        } else {
+            nfa_add(&l[0], r->nfa_start);
+            ctx->dfa_idle = dfa_state(ctx, &l[0], &l[1]);
+        }
+    }
+    off = ctx->dfa_start;
+    for (s = str; s < ctx->end; s++) {
+        if (off == ctx->dfa_idle && r->first_cnt) { /* Skip to next possible start of match */
+            if ((s = prefilter_first(r, s, ctx->m_last, ctx->end)) == NULL) {
+                return found;
+            }
+        }
+        st = DFA_STATE(ctx, off - 1);
+        if ((st->flags & DFA_MATCH) && (found += dfa_mark(r, st->pc, st->len, ids)) == r->p_cnt) {
+            return found;                       /* All patterns matched */
+        } else if (r->nfa_start == NFA_NONE && !st->len) { /* No more active instructions */
+            return found;
+        }
+        if ((next = st->next[(uint8_t)*s]) != 0) { /* Transition is cached */
+            REGEX_STAT(ctx, dfa_hits);
+            off = next;
+        } else {
+            REGEX_STAT(ctx, dfa_misses);
+            off = dfa_next(ctx, off, *s, 1);
+        }
+    }
+    st = DFA_STATE(ctx, off - 1);
+    if (st->flags & DFA_MATCH_END) {            /* End assertions pass at the end of input */
+        nfa_lists(ctx, l);
+        for (i = 0; i < st->len; i++) {
+            nfa_add(&l[0], st->pc[i]);
+        }
+        nfa_closure(r, &l[0], 1);
+        found += dfa_mark(r, l[0].dense, l[0].len, ids);
+    }
+    return found;
+}
+
+/**
+ * \brief           Reset all capturing group entries in user array
+ */
+static void
+reset_matches(regex_match_ctx_t* ctx) {
+    size_t i;
+    for (i = 0; i < ctx->m_totlen; i++) {
+        ctx->matches[i].s = NULL;
+        ctx->matches[i].len = 0;
+    }
+}
+
+/**
+ * \brief           Search for match with backtracking engine
+ *
+ * For \ref REGEX_MODE_LONGEST, all paths from the leftmost start are tried and the furthest end is kept.
+ * Groups are recorded by second pass from that start, which must end exactly there.
+ *
+ * \note            Visited bitmap is used when context has enough memory for pattern and input length
+ * \param[in]       stack: Backtracking stack
+ * \param[in]       stack_len: Number of frames in stack
+ * \param[in]       p: Pointer to first pattern entry, after anchor
+ * \param[in]       anc: Set to 1 if pattern is anchored to the beginning
+ * \param[in]       str: Pointer to input position to start search at
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if stack is full or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+static uint8_t
+search_backtrack(regex_match_ctx_t* ctx, bt_frame_t* stack, size_t stack_len, const p_t* p, uint8_t anc, const char* str, regex_match_t* span) {
+    const regex_t* r = ctx->r;
+    size_t k;
+    uint8_t res = 0;
+
+    if (r->loop_depth && stack == ctx->bt) {    /* Memory after stack deep enough for input length is visited bitmap */
+        k = BT_LOOP_FRAMES(r->p_len, r->loop_depth, (size_t)(ctx->end - str));
+        ctx->visit = k < stack_len ? (uint8_t*)&stack[k] : NULL;
+        ctx->visit_len = k < stack_len ? (stack_len - k) * sizeof(*stack) : 0;
+        stack_len = k < stack_len ? k : stack_len;
+    }
+    ctx->visit_s = NULL;
+    if (ctx->visit != NULL && BT_VISIT_MEM(r->p_len, (size_t)(ctx->end - str)) <= ctx->visit_len) {
+        ctx->visit_s = str;                     /* Failed pairs stay failed for all start positions */
+        memset(ctx->visit, 0x00, BT_VISIT_MEM(r->p_len, (size_t)(ctx->end - str)));
+    }
+    ctx->m_best = NULL;
+    do {
+        if (!anc && r->first_cnt) {             /* Skip to next possible start of match */
+            if ((str = prefilter_first(r, str, ctx->m_last, ctx->end)) == NULL) {
+                break;
+            }
+        }
+        REGEX_DEBUG(r, REGEX_EVT_MATCH_START, NULL, str);
+        REGEX_STAT(ctx, starts);
+        res = match_pattern(ctx, stack, stack_len, p, str); /* Simply process entire string, even if it is NULL */
+        if (!res && ctx->m_best != NULL) {      /* Longest match was found, all paths failed on purpose */
+            ctx->m_end = ctx->m_best;
+            res = 1;
+            if (ctx->m_totlen && r->g_len) {    /* Groups of longest path are recorded by second pass */
+                ctx->m_req = ctx->m_best;
+                if (ctx->visit_s != NULL) {     /* Paths marked by first pass did not fail */
+                    memset(ctx->visit, 0x00, BT_VISIT_MEM(r->p_len, (size_t)(ctx->end - ctx->visit_s)));
+                }
+                reset_matches(ctx);
+                res = match_pattern(ctx, stack, stack_len, p, str);
+            }
+        }
+        if (res == 1) {
+            REGEX_DEBUG(r, REGEX_EVT_MATCH, NULL, str);
+            ctx->m_len = r->g_len < ctx->m_totlen ? r->g_len : ctx->m_totlen;
+            if (span != NULL) {
+                span->s = str;
+                span->len = ctx->m_end - str;
+            }
             return 1;                           /* Match was found */
         }
-    } while (*str++ && !anc);                   /* Start from all the angles until string is valid */
-    return 0;                                   /* Ooops, no match found! */
-}
\ No newline at end of file
+    } while (!res && !anc && str++ != ctx->m_last); /* Start from all the angles until last start position */
+    REGEX_DEBUG(r, REGEX_EVT_NO_MATCH, NULL, NULL);
+    reset_matches(ctx);                         /* Remove results of failed attempts */
+    return res;                                 /* Ooops, no match found! */
+}
+
+/**
+ * \brief           Search for match with backtracking engine and \ref REGEX_CFG_BT_STACK frames on call stack
+ * \param[in]       p: Pointer to first pattern entry, after anchor
+ * \param[in]       anc: Set to 1 if pattern is anchored to the beginning
+ * \param[in]       str: Pointer to input position to start search at
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if stack is full or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+static uint8_t
+search_local(regex_match_ctx_t* ctx, const p_t* p, uint8_t anc, const char* str, regex_match_t* span) {
+    bt_frame_t stack[REGEX_CFG_BT_STACK];
+
+    return search_backtrack(ctx, stack, REGEX_CFG_BT_STACK, p, anc, str, span);
+}
+
+/**
+ * \brief           Search for match with selected engine, after matching state is set up
+ * \param[in]       p: Pointer to first pattern entry, after anchor
+ * \param[in]       anc: Set to 1 if pattern is anchored to the beginning
+ * \param[in]       str: Pointer to input position to start search at, end is set in \ref regex_match_ctx_t
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \return          1 on match, 0 otherwise
+ */
+static uint8_t
+search_at(regex_match_ctx_t* ctx, const p_t* p, uint8_t anc, const char* str, regex_match_t* span) {
+    const regex_t* r = ctx->r;
+    const char* end;
+
+    /* Reject input without required literal, literal of limited search is searched only up to its distance from last start */
+    if (r->req_len && (ctx->m_last == ctx->end || r->req_dist != (size_t)-1)) {
+        end = ctx->end;
+        if ((size_t)(end - ctx->m_last) > r->req_dist + r->req_len) {
+            end = ctx->m_last + r->req_dist + r->req_len;
+        }
+        if (!prefilter_required(r, str, end)) {
+            REGEX_STAT(ctx, prefilter_rejects);
+            return 0;
+        }
+    }
+
+    /* State-set engines do not record groups, backtracking is used when groups are requested */
+    if (!ctx->m_totlen || !r->g_len) {
+        if (r->engine == REGEX_ENGINE_NFA) {    /* Use state-set engine */
+            return nfa_match(ctx, str, span);
+        } else if (r->engine == REGEX_ENGINE_DFA) { /* Use lazy DFA engine, span is computed by NFA on match */
+            if (MODE_ANCHORED(ctx) && r->nfa_start != NFA_NONE) {   /* Cached transitions start new match on every position */
+                return nfa_match(ctx, str, span);
+            }
+            return dfa_match(ctx, str) && (span == NULL || nfa_match(ctx, str, span));
+        }
+    }
+
+    if (ctx->bt == NULL) {                      /* Context has no stack memory */
+        return search_local(ctx, p, anc, str, span);
+    }
+    return search_backtrack(ctx, ctx->bt, ctx->bt_len, p, anc, str, span);
+}
+
+/**
+ * \brief           Search for match in input buffer with selected engine
+ * \param[in]       str: Pointer to input buffer
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in]       from: Offset in buffer to start search at
+ * \param[in]       last: Offset of last position match may start at, `len` for search of entire buffer
+ * \param[in]       mode: Match mode, combination of `REGEX_MODE_*` flags, `0` for default search
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise
+ */
+static uint8_t
+search(regex_match_ctx_t* ctx, const char* str, size_t len, size_t from, size_t last, uint8_t mode, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    const regex_t* r = ctx->r;
+    p_t* p;
+    uint8_t anc, res;
+
+    p = r->p;                                   /* Set start pattern */
+    anc = p->type == P_BEGIN ? (p++, 1) : 0;    /* Check if string must start with anchor */
+    if (mode & REGEX_MODE_EXISTS) {             /* No span and groups, engines stop on first accepting state */
+        span = NULL;
+        matches = NULL;
+        m_len = 0;
+        mode &= (uint8_t)~REGEX_MODE_LONGEST;
+    }
+
+    ctx->matches = matches;                     /* Set matching pointer */
+    ctx->m_totlen = m_len;                      /* Set total length of available matching */
+    ctx->m_len = 0;                             /* Reset number of used end matching arrays */
+    ctx->end = str + len;                       /* Set end of input */
+    ctx->m_last = str + (last < len ? last : len);
+    ctx->steps = 0;                             /* Budget is given to each search */
+    reset_matches(ctx);
+
+    if (r->longest && (span != NULL || m_len)) {    /* Backtracking span is the same as of NFA and DFA engines */
+        mode |= REGEX_MODE_LONGEST;
+    }
+    if ((anc && from) || from > last) {         /* Anchored pattern may only match at the beginning */
+        return 0;
+    }
+    ctx->mode = mode;
+    ctx->m_req = mode & REGEX_MODE_FULL_MATCH ? ctx->end : NULL;
+    res = search_at(ctx, p, anc || MODE_ANCHORED(ctx), str + from, span);
+    ctx->mode = 0;                              /* Batch and parallel searches use context directly */
+    ctx->m_req = NULL;
+    return res;
+}
+
+/**
+ * \brief           Find next match starting at or before last position and resume after it
+ * \param[in]       str: Pointer to input buffer, the same for all calls
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in]       last: Offset of last position match may start at, `len` for search of entire buffer.
+ *                      Match which starts at or before it may end after it
+ * \param[in,out]   pos: Offset to start search at, updated to resume position after the call
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 if match was found, 0 if there are no more matches,
+ *                      \ref REGEX_EXHAUSTED or \ref REGEX_BUDGET_EXCEEDED when matching stopped
+ */
+static uint8_t
+find_next(regex_match_ctx_t* ctx, const char* str, size_t len, size_t last, size_t* pos, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    regex_match_t m;
+    uint8_t res = 0;
+
+    if (*pos > len || (res = search(ctx, str, len, *pos, last, 0, &m, matches, m_len)) != 1) {
+        *pos = len + 1;                         /* Do not search again */
+        return res;
+    }
+    *pos = (size_t)(m.s - str) + m.len + (m.len == 0); /* Empty match must not be found again on the same position */
+    if (span != NULL) {
+        *span = m;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Set up matching context for regex with selected engine
+ * \param[in]       mem: Memory for state lists, backtracking stack and DFA cache.
+ *                      For \ref REGEX_ENGINE_BACKTRACK, memory after stack is used as visited bitmap,
+ *                      unless pattern has repeated groups, then all memory is stack, also for \ref REGEX_ENGINE_NFA,
+ *                      and each search uses memory after stack deep enough for its input as bitmap
+ * \param[in]       mem_len: Size of memory in units of bytes
+ */
+static void
+ctx_setup(regex_match_ctx_t* ctx, const regex_t* r, void* mem, size_t mem_len) {
+    uint8_t* m;
+
+    ctx->r = r;
+    ctx->matches = NULL;
+    ctx->m_len = ctx->m_totlen = 0;
+    ctx->bt = NULL;
+    ctx->bt_len = 0;
+    ctx->visit = NULL;
+    ctx->visit_len = 0;
+    ctx->visit_s = NULL;
+    ctx->end = ctx->m_last = NULL;
+    ctx->m_req = ctx->m_best = NULL;
+    ctx->mode = 0;
+    ctx->steps = 0;
+    ctx->step_limit = 0;
+#if REGEX_CFG_STATS
+    memset(&ctx->stats, 0x00, sizeof(ctx->stats));
+#endif /* REGEX_CFG_STATS */
+    ctx->lists = NULL;
+    ctx->dfa = NULL;
+    if (mem == NULL) {
+        return;
+    }
+    m = (uint8_t*)NFA_ALIGN_UP((uintptr_t)mem);
+    if (r->engine == REGEX_ENGINE_NFA || r->engine == REGEX_ENGINE_DFA) {
+        ctx->lists = m;
+        memset(m, 0x00, nfa_lists_mem(r->nfa_len)); /* Sparse arrays are cleared once, values are always valid indexes after that */
+        m += NFA_ALIGN_UP(nfa_lists_mem(r->nfa_len));
+        ctx->bt = m;                            /* Groups are recorded by backtracking, with stack it never exhausts */
+        ctx->bt_len = BT_FRAMES(r->p_len);
+        if (r->engine == REGEX_ENGINE_NFA && r->loop_depth
+            && mem_len - (size_t)(m - (uint8_t*)mem) > bt_mem(r)) {  /* Iterations of repeated groups use all remaining memory */
+            ctx->bt_len = (mem_len - (size_t)(m - (uint8_t*)mem)) / sizeof(bt_frame_t);
+        }
+        m += bt_mem(r);
+        if (r->engine == REGEX_ENGINE_DFA) {    /* Cache uses all remaining memory */
+            ctx->dfa = (uint32_t*)m;
+            ctx->dfa_len = (mem_len - (size_t)(m - (uint8_t*)mem)) / sizeof(uint32_t);
+            dfa_flush(ctx);
+            ctx->dfa_flushes = 0;
+#if REGEX_CFG_STATS
+            ctx->stats.dfa_flushes = 0;
+#endif /* REGEX_CFG_STATS */
+        }
+    } else if (mem_len > (size_t)(m - (uint8_t*)mem)) {  /* Stack is never deeper than for pattern length */
+        mem_len -= (size_t)(m - (uint8_t*)mem);
+        ctx->bt_len = mem_len / sizeof(bt_frame_t);
+        if (!r->loop_depth) {                   /* Iterations of repeated groups use all memory as stack */
+            ctx->bt_len = ctx->bt_len < BT_FRAMES(r->p_len) ? ctx->bt_len : BT_FRAMES(r->p_len);
+        }
+        ctx->bt = ctx->bt_len ? m : NULL;
+        if (mem_len > ctx->bt_len * sizeof(bt_frame_t)) {   /* Remaining memory is visited bitmap */
+            ctx->visit = m + ctx->bt_len * sizeof(bt_frame_t);
+            ctx->visit_len = mem_len - ctx->bt_len * sizeof(bt_frame_t);
+        }
+    }
+}
+
+/*
+ * Parallel search
+ *
+ * Input buffer is split to chunks at boundary bytes and each chunk is searched as separate job
+ * with context of the worker running it. Chunk search only starts matches in the chunk,
+ * but uses entire buffer, so matches may continue over chunk end.
+ *
+ * Match found from an offset depends only on leftmost start at or after it, so buffered chunk match
+ * is the same as found by sequential search, once sequential search resumes at or before the offset
+ * chunk search found it from. Until then, merge searches sequentially, which is only needed
+ * after matches crossing chunk end or when chunk buffer is full.
+ */
+
+#define PAR_AFTER(str, m)                       ((size_t)((m)->s - (str)) + (m)->len + ((m)->len == 0))
+
+/**
+ * \brief           Chunk of parallel search
+ */
+typedef struct {
+    size_t start;                               /*!< Offset of first byte of chunk */
+    size_t end;                                 /*!< Offset of first byte after chunk, matches starting before it belong to chunk */
+    size_t cnt;                                 /*!< Number of buffered matches */
+    size_t resume;                              /*!< Offset chunk search continues at after last buffered match */
+    uint8_t done;                               /*!< Set to 1 if all matches starting in chunk are buffered */
+} par_chunk_t;
+
+/**
+ * \brief           Parallel search state shared by all jobs
+ */
+typedef struct {
+    const char* str;                            /*!< Pointer to input buffer */
+    size_t len;                                 /*!< Length of input buffer */
+    par_chunk_t* chunks;                        /*!< Array of chunks */
+    regex_match_t* m;                           /*!< Match buffers of all chunks */
+    size_t m_len;                               /*!< Number of buffered matches per chunk */
+    regex_match_ctx_t* ctx;                     /*!< Matching context of each worker */
+} par_job_t;
+
+/**
+ * \brief           Split input buffer to chunks
+ * \param[in]       cfg: Parallel search configuration
+ * \param[out]      chunks: Array for chunks, at least `len / chunk_size + 1` entries long
+ * \return          Number of chunks
+ */
+static size_t
+par_plan(const regex_parallel_t* cfg, const char* str, size_t len, par_chunk_t* chunks) {
+    const char* d;
+    size_t n = 0, start = 0, end;
+
+    do {
+        end = len - start > cfg->chunk_size ? start + cfg->chunk_size : len;
+        if (end < len && cfg->delim != REGEX_PARALLEL_SPLIT_ANY) {  /* Extend chunk to next boundary */
+            d = memchr(str + end, cfg->delim, len - end);
+            end = d != NULL ? (size_t)(d - str) + 1 : len;
+        }
+        chunks[n].start = start;
+        chunks[n].end = end;
+        n++;
+        start = end;
+    } while (start < len);
+    chunks[n - 1].end = len + 1;                /* Empty match at the end of input belongs to last chunk */
+    return n;
+}
+
+/**
+ * \brief           Search single chunk and buffer matches starting in it
+ * \param[in]       arg: Pointer to \ref par_job_t
+ * \param[in]       job: Chunk index
+ * \param[in]       worker: Worker index, selects matching context
+ */
+static void
+par_job(void* arg, size_t job, size_t worker) {
+    par_job_t* pj = arg;
+    par_chunk_t* ch = &pj->chunks[job];
+    regex_match_t* m = &pj->m[job * pj->m_len];
+    size_t pos;
+    uint8_t res;
+
+    ch->cnt = 0;
+    ch->done = 0;
+    ch->resume = ch->start;
+    while (ch->cnt < pj->m_len) {
+        pos = ch->resume;
+        if ((res = find_next(&pj->ctx[worker], pj->str, pj->len, ch->end - 1, &pos, &m[ch->cnt], NULL, 0)) != 1) {
+            ch->done = res == 0;                /* No more matches starting in chunk, merge searches again if matching stopped */
+            break;
+        }
+        ch->resume = pos;
+        ch->cnt++;
+    }
+}
+
+/**
+ * \brief           Merge buffered chunk matches and report them in order of sequential search
+ * \param[in]       pj: Parallel search state with all chunks searched
+ * \param[in]       n: Number of chunks
+ * \param[in]       fn: Callback function called for each match
+ * \param[in]       arg: User argument passed to callback function
+ * \return          1 if all matches were reported, 0 if matching stopped
+ */
+static uint8_t
+par_merge(par_job_t* pj, size_t n, regex_stream_fn fn, void* arg) {
+    const char* str = pj->str;
+    const par_chunk_t* ch;
+    const regex_match_t* m;
+    regex_match_t sm;
+    size_t j, i, res, next, pos = 0;
+    uint8_t found;
+
+    for (j = 0; j < n; j++) {
+        ch = &pj->chunks[j];
+        m = &pj->m[j * pj->m_len];
+        res = ch->start;                        /* Offset chunk search found m[i] from */
+        pos = pos > ch->start ? pos : ch->start;/* No match starts between previous position and chunk */
+        for (i = 0;;) {
+            while (i < ch->cnt && (size_t)(m[i].s - str) < pos) {  /* Skip matches overlapped by reported ones */
+                res = PAR_AFTER(str, &m[i]);
+                i++;
+            }
+            if (i < ch->cnt && res <= pos) {    /* Chunk search is in sync with sequential one */
+                fn(arg, (size_t)(m[i].s - str), m[i].len);
+                pos = res = PAR_AFTER(str, &m[i]);
+                i++;
+            } else if (i == ch->cnt && ch->done && res <= pos) {
+                break;                          /* No more matches starting in chunk */
+            } else {                            /* Search sequentially until chunk matches can be used */
+                next = pos;
+                if ((found = find_next(&pj->ctx[0], str, pj->len, ch->end - 1, &next, &sm, NULL, 0)) == 0) {
+                    pos = pos > ch->end ? pos : ch->end;
+                    break;                      /* No more matches starting in chunk */
+                } else if (found != 1) {
+                    return 0;                   /* Matching stopped */
+                }
+                fn(arg, (size_t)(sm.s - str), sm.len);
+                pos = next;
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get size of engine memory for context of single parallel search worker
+ * \note            Worker DFA cache is as big as cache of default context
+ * \param[in]       r: Regex structure with compiled pattern
+ * \return          Memory size in units of bytes
+ */
+static size_t
+par_ctx_mem_size(const regex_t* r) {
+    size_t len = regex_ctx_mem_size(r, 2);
+
+    if (r->engine == REGEX_ENGINE_DFA) {
+        len = NFA_ALIGN_UP(nfa_lists_mem(r->nfa_len)) + bt_mem(r) + NFA_ALIGN - 1 + r->ctx.dfa_len * sizeof(uint32_t);
+    }
+    return NFA_ALIGN_UP(len);
+}
+
+#if REGEX_CFG_PARALLEL_PTHREAD
+
+/**
+ * \brief           Job queue of built-in executor, each thread takes next job when it is done with previous one
+ */
+typedef struct {
+    pthread_mutex_t lock;                       /*!< Lock for next job index */
+    size_t next;                                /*!< Index of next job to take */
+    size_t jobs;                                /*!< Number of jobs */
+    regex_job_fn fn;                            /*!< Job function */
+    void* arg;                                  /*!< Argument for job function */
+} par_pool_t;
+
+/**
+ * \brief           Thread of built-in executor
+ */
+typedef struct {
+    par_pool_t* pool;                           /*!< Shared job queue */
+    size_t worker;                              /*!< Worker index of thread */
+} par_thread_t;
+
+/**
+ * \brief           Take and process jobs until queue is empty
+ * \param[in]       arg: Pointer to \ref par_thread_t
+ * \return          `NULL`
+ */
+static void*
+par_thread(void* arg) {
+    par_thread_t* t = arg;
+    par_pool_t* pool = t->pool;
+    size_t job;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        job = pool->next < pool->jobs ? pool->next++ : pool->jobs;
+        pthread_mutex_unlock(&pool->lock);
+        if (job == pool->jobs) {
+            break;
+        }
+        pool->fn(pool->arg, job, t->worker);
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Built-in executor, runs jobs on POSIX threads together with calling thread
+ */
+static void
+par_exec(void* exec_arg, size_t jobs, size_t workers, regex_job_fn fn, void* arg) {
+    pthread_t th[REGEX_CFG_PARALLEL_MAX_THREADS];
+    par_thread_t t[REGEX_CFG_PARALLEL_MAX_THREADS];
+    uint8_t started[REGEX_CFG_PARALLEL_MAX_THREADS];
+    par_pool_t pool;
+    size_t i, n;
+
+    (void)exec_arg;
+    n = workers < jobs ? workers : jobs;
+    n = n < REGEX_CFG_PARALLEL_MAX_THREADS ? n : REGEX_CFG_PARALLEL_MAX_THREADS;
+    pthread_mutex_init(&pool.lock, NULL);
+    pool.next = 0;
+    pool.jobs = jobs;
+    pool.fn = fn;
+    pool.arg = arg;
+    for (i = 0; i < n; i++) {
+        t[i].pool = &pool;
+        t[i].worker = i;
+        started[i] = i > 0 && pthread_create(&th[i], NULL, par_thread, &t[i]) == 0;
+    }
+    par_thread(&t[0]);                          /* Calling thread is worker 0, it completes all jobs if no thread started */
+    for (i = 1; i < n; i++) {
+        if (started[i]) {
+            pthread_join(th[i], NULL);
+        }
+    }
+    pthread_mutex_destroy(&pool.lock);
+}
+
+#else
+
+/**
+ * \brief           Built-in executor, runs jobs one by one on calling thread
+ */
+static void
+par_exec(void* exec_arg, size_t jobs, size_t workers, regex_job_fn fn, void* arg) {
+    size_t i;
+
+    (void)exec_arg;
+    (void)workers;
+    for (i = 0; i < jobs; i++) {
+        fn(arg, i, 0);
+    }
+}
+
+#endif /* REGEX_CFG_PARALLEL_PTHREAD */
+
+/*
+ * Compiled image
+ *
+ * Image holds compiled pattern list with offsets instead of pointers,
+ * followed by class bitmaps and literal pool with all strings used by pattern entries.
+ * Values are stored in native byte order, image is valid for targets with the same byte order.
+ */
+
+#define IMAGE_MAGIC                             0x33495852UL    /*!< "RXI3" in little-endian byte order */
+#define IMAGE_STR(t)                            (IS_SEQUENCE(t) || (t) == P_CHAR_CLASS || (t) == P_CHAR_CLASS_NOT)
+
+/**
+ * \brief           Image header
+ */
+typedef struct {
+    uint32_t magic;                             /*!< Image identifier, \ref IMAGE_MAGIC */
+    uint32_t size;                              /*!< Total image size in units of bytes */
+    uint32_t p_len;                             /*!< Number of pattern entries */
+    uint32_t p_cnt;                             /*!< Number of patterns */
+    uint32_t c_len;                             /*!< Number of class bitmaps */
+    uint32_t g_len;                             /*!< Number of capturing groups */
+} image_hdr_t;
+
+/**
+ * \brief           Pattern entry in image
+ */
+typedef struct {
+    uint32_t str;                               /*!< Offset of string in literal pool or character value */
+    uint32_t len;                               /*!< Length of string */
+    uint32_t min, max;                          /*!< Minimal or maximal readings */
+    uint16_t cls;                               /*!< Index of compiled class or capturing group */
+    uint8_t type;                               /*!< Pattern type */
+    uint8_t poss;                               /*!< Possessive repetitions */
+} image_entry_t;
+
+/*
+ * Compiled pattern cache
+ *
+ * Cache memory holds hash table and equal slots, each slot with one compiled pattern,
+ * its pattern entries, classes and copy of pattern text. Pattern is compiled from the copy,
+ * so compiled pattern points only to slot memory and does not depend on caller's string.
+ * Used slots are linked to hash bucket chain and to circular LRU list,
+ * least recently used slot is reused when new pattern does not fit anymore.
+ */
+
+/**
+ * \brief           Get size of single cache slot in units of bytes
+ */
+#define CACHE_SLOT_SIZE(p_len, c_len, text_len) NFA_ALIGN_UP(sizeof(cache_slot_t) + (p_len) * sizeof(regex_pattern_t) + (c_len) * sizeof(regex_class_t) + (text_len) + 1)
+
+/**
+ * \brief           Get cache slot from slot index + 1
+ */
+#define CACHE_SLOT(cache, i)                    ((cache_slot_t*)((cache)->mem + ((size_t)(i) - 1) * (cache)->slot_size))
+
+/**
+ * \brief           Get pattern entries, classes and pattern text of cache slot
+ */
+#define CACHE_SLOT_P(sl)                        ((regex_pattern_t*)((sl) + 1))
+#define CACHE_SLOT_C(cache, sl)                 ((regex_class_t*)(CACHE_SLOT_P(sl) + (cache)->p_len))
+#define CACHE_SLOT_TEXT(cache, sl)              ((char*)(CACHE_SLOT_C(cache, sl) + (cache)->c_len))
+
+/**
+ * \brief           Cache slot header, followed by pattern entries, classes and pattern text
+ */
+typedef struct {
+    regex_t r;                                  /*!< Compiled pattern */
+    uint32_t hash;                              /*!< Hash of pattern text */
+    uint32_t chain;                             /*!< Next slot in hash bucket + 1, 0 if last */
+    uint32_t prev, next;                        /*!< Neighbour slots in LRU list, next is also used by free list */
+    size_t len;                                 /*!< Length of pattern text */
+} cache_slot_t;
+
+/**
+ * \brief           Get number of hash table buckets for number of slots
+ */
+static size_t
+cache_buckets(size_t slots) {
+    size_t n = 1;
+
+    for (; n < slots; n <<= 1) {}
+    return n;
+}
+
+/**
+ * \brief           Remove slot from LRU list
+ * \param[in]       i: Slot index + 1
+ */
+static void
+cache_lru_remove(regex_cache_t* cache, uint32_t i) {
+    cache_slot_t* sl = CACHE_SLOT(cache, i);
+
+    if (sl->next == i) {                        /* Last slot in list */
+        cache->lru = 0;
+        return;
+    }
+    CACHE_SLOT(cache, sl->prev)->next = sl->next;
+    CACHE_SLOT(cache, sl->next)->prev = sl->prev;
+    if (cache->lru == i) {
+        cache->lru = sl->next;
+    }
+}
+
+/**
+ * \brief           Insert slot to LRU list as most recently used one
+ * \param[in]       i: Slot index + 1
+ */
+static void
+cache_lru_insert(regex_cache_t* cache, uint32_t i) {
+    cache_slot_t* sl = CACHE_SLOT(cache, i), *head;
+
+    if (!cache->lru) {
+        sl->prev = sl->next = i;
+    } else {                                    /* Insert before head, the end of circular list is least recently used */
+        head = CACHE_SLOT(cache, cache->lru);
+        sl->next = cache->lru;
+        sl->prev = head->prev;
+        CACHE_SLOT(cache, head->prev)->next = i;
+        head->prev = i;
+    }
+    cache->lru = i;
+}
+
+/**
+ * \brief           Remove least recently used slot from cache
+ * \return          Slot index + 1
+ */
+static uint32_t
+cache_evict(regex_cache_t* cache) {
+    uint32_t i = CACHE_SLOT(cache, cache->lru)->prev, *b;
+    cache_slot_t* sl = CACHE_SLOT(cache, i);
+
+    cache_lru_remove(cache, i);
+    for (b = &cache->buckets[sl->hash & (cache->buckets_len - 1)]; *b != i; b = &CACHE_SLOT(cache, *b)->chain) {}
+    *b = sl->chain;                             /* Remove from hash bucket */
+    cache->evictions++;
+    return i;
+}
+
+/*
+ * Compilation arena
+ *
+ * Arena holds copy of pattern text, followed by aligned pattern entries and character classes.
+ * Array lengths are upper bounds found by single scan of pattern text, so pattern is compiled only once.
+ */
+
+/**
+ * \brief           Get upper bounds of arrays for compiled pattern
+ *
+ * Each pattern entry uses at least one character of pattern text, plus one terminating entry.
+ * Alternation outside of groups adds two entries of internal group.
+ * Each class starts with `[` or `\`, with `i` flag each letter may be compiled to class too.
+ *
+ * \param[in]       pattern: Pattern string in `/pattern/g` format
+ * \param[out]      len: Length of pattern string
+ * \param[out]      p_len: Maximal number of pattern entries
+ * \param[out]      c_len: Maximal number of character classes
+ * \return          Arena size in units of bytes, 0 if pattern is too short
+ */
+static size_t
+arena_bounds(const char* pattern, size_t* len, size_t* p_len, size_t* c_len) {
+    const char* s, *flags = NULL;
+    size_t alt = 0, letters = 0;
+
+    *c_len = 0;
+    for (s = pattern; *s; s++) {
+        if (*s == '[' || *s == '\\') {
+            (*c_len)++;
+        } else if (*s == '|') {
+            alt = 2;
+        } else if (*s == '/') {
+            flags = s + 1;                      /* Flags follow last slash */
+        } else if (IS_C_ALPHA(*s)) {
+            letters++;
+        }
+    }
+    if (flags != NULL && strchr(flags, 'i') != NULL) {  /* Folded letters are compiled to classes */
+        *c_len += letters;
+    }
+    *len = (size_t)(s - pattern);
+    if (*len < 3) {
+        return 0;
+    }
+    *p_len = *len - 3 + 1 + alt;
+    return NFA_ALIGN_UP(*len + 1) + *p_len * sizeof(regex_pattern_t) + *c_len * sizeof(regex_class_t) + NFA_ALIGN - 1;
+}
+
+/*
+ * Public API functions
+ */
+
+/**
+ * \brief           Prepare and compile pattern before it can be used for matching
+ * \param[in]       r: Pointer to empty \ref regex_t structure for matching
+ * \param[in]       pattern: Pointer to pattern string
+ * \param[in]       p: Pointer to array to hold patterns data to
+ * \param[in]       p_len: Size of array for patterns
+ * \param[in]       c: Pointer to array to hold compiled character classes to
+ * \param[in]       c_len: Size of array for character classes
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_prepare(regex_t* r, const char* pattern, regex_pattern_t* p, size_t p_len, regex_class_t* c, size_t c_len) {
+    return regex_prepare_set(r, &pattern, 1, p, p_len, c, c_len);
+}
+
+/**
+ * \brief           Get size of arena required to compile pattern with \ref regex_prepare_arena
+ *
+ * Size is upper bound found without compiling pattern,
+ * \ref regex_prepare_arena returns number of bytes actually used.
+ *
+ * \param[in]       pattern: Pattern string in `/pattern/g` format
+ * \return          Arena size in units of bytes, 0 if pattern is not valid
+ */
+size_t
+regex_compiled_size(const char* pattern) {
+    size_t len, p_len, c_len;
+
+    return arena_bounds(pattern, &len, &p_len, &c_len);
+}
+
+/**
+ * \brief           Prepare and compile pattern to single caller-provided arena
+ *
+ * Pattern text is copied to arena and pattern entries and classes are placed after it,
+ * so compiled pattern does not depend on caller's string and is released by releasing arena.
+ * Classes are moved next to used pattern entries, end of arena after returned size is not used.
+ *
+ * \param[out]      r: Output handle to save compiled data to
+ * \param[in]       pattern: Pattern string in `/pattern/g` format
+ * \param[in]       mem: Arena memory, must stay valid while compiled pattern is used
+ * \param[in]       mem_len: Size of arena in units of bytes, at least \ref regex_compiled_size
+ * \return          Number of used arena bytes on success, 0 otherwise
+ */
+size_t
+regex_prepare_arena(regex_t* r, const char* pattern, void* mem, size_t mem_len) {
+    size_t len, p_len, c_len, size;
+    uint8_t* m;
+
+    size = arena_bounds(pattern, &len, &p_len, &c_len);
+    if (!size || mem == NULL || mem_len < size) {
+        return 0;
+    }
+    m = (uint8_t*)mem;
+    memcpy(m, pattern, len + 1);
+    if (!regex_prepare(r, (const char*)m, (regex_pattern_t*)NFA_ALIGN_UP((uintptr_t)m + len + 1), p_len,
+                       (regex_class_t*)(NFA_ALIGN_UP((uintptr_t)m + len + 1) + p_len * sizeof(regex_pattern_t)), c_len)) {
+        return 0;
+    }
+    r->p_totlen = r->p_len;                     /* Arrays are shrunk to used length */
+    memmove(r->p + r->p_len, r->c, r->c_len * sizeof(regex_class_t));
+    r->c = (regex_class_t*)(r->p + r->p_len);
+    r->c_totlen = r->c_len;
+    return (size_t)((uint8_t*)(r->c + r->c_len) - m);
+}
+
+/**
+ * \brief           Check if string and pattern matches, public API function
+ * \param[in]       pattern: Pattern to check in string
+ * \param[in]       str: Pointer to NULL-terminated input string to make match on
+ * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_match(regex_t* r, const char* str, regex_match_t* matches, size_t m_len) {
+    return regex_match_n(r, str, strlen(str), matches, m_len);
+}
+
+/**
+ * \brief           Check if input buffer and pattern matches, public API function
+ * \note            Input does not need to be NULL-terminated, `$` matches at `str + len`
+ * \param[in]       pattern: Pattern to check in string
+ * \param[in]       str: Pointer to input buffer to make match on
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `NULL` if not used.
+ *                      Groups are recorded by backtracking engine, regardless of selected engine.
+ *                      Number of valid entries is available in \ref regex_match_ctx_t.m_len of `r->ctx` after match
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_match_n(regex_t* r, const char* str, size_t len, regex_match_t* matches, size_t m_len) {
+    return regex_match_ctx(&r->ctx, str, len, matches, m_len);
+}
+
+/**
+ * \brief           Check if input buffer and pattern matches with explicit match mode, public API function
+ *
+ * Mode is combination of flags:
+ *  - \ref REGEX_MODE_ANCHORED_START: match must start at the beginning of buffer, as if pattern started with `^`
+ *  - \ref REGEX_MODE_FULL_MATCH: match must cover entire buffer
+ *  - \ref REGEX_MODE_EXISTS: only result is computed, DFA engine stops on first match state
+ *      and backtracking engine does not record groups. Span and groups are not written
+ *  - \ref REGEX_MODE_LONGEST: longest match from leftmost start is reported by all engines.
+ *      Backtracking engine otherwise stops repetitions as soon as rest of pattern matches
+ *
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       str: Pointer to input buffer to make match on
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in]       mode: Match mode, combination of `REGEX_MODE_*` flags, `0` for the same search as \ref regex_match_n
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_match_mode(regex_t* r, const char* str, size_t len, uint8_t mode, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    return regex_match_mode_ctx(&r->ctx, str, len, mode, span, matches, m_len);
+}
+
+/**
+ * \brief           Find next match in input buffer, used to iterate over all matches
+ *
+ * Search starts at `*pos` offset and continues after the end of found match on next call.
+ * Pattern anchored with `^` matches only at the beginning of buffer.
+ *
+ * NFA, DFA and auto engines report leftmost-longest match, also when groups are recorded.
+ * Backtracking engine reports leftmost match with repetitions stopped as soon as rest of pattern matches.
+ *
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       str: Pointer to input buffer, the same for all calls
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in,out]   pos: Offset to start search at, set to `0` before first call.
+ *                      Updated to resume position after the call
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 if match was found, 0 if there are no more matches,
+ *                      \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_find_next(regex_t* r, const char* str, size_t len, size_t* pos, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    return regex_find_next_ctx(&r->ctx, str, len, pos, span, matches, m_len);
+}
+
+/**
+ * \brief           Get size of memory required for matching context
+ * \note            Engine must be selected before, see \ref regex_ctx_init
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       states: Number of DFA states cache must be able to hold in any case, minimum is `2`.
+ *                      Used only for \ref REGEX_ENGINE_DFA
+ * \return          Memory size in units of bytes, backtracking stack included
+ */
+size_t
+regex_ctx_mem_size(const regex_t* r, size_t states) {
+    size_t len = bt_mem(r) + NFA_ALIGN - 1;
+
+    if (r->engine == REGEX_ENGINE_NFA || r->engine == REGEX_ENGINE_DFA) {
+        len += NFA_ALIGN_UP(nfa_lists_mem(r->nfa_len));
+    }
+    if (r->engine == REGEX_ENGINE_DFA) {
+        states = states < 2 ? 2 : states;
+        len += (DFA_HASH_SIZE + states * DFA_STATE_WORDS(r->nfa_len)) * sizeof(uint32_t);
+    }
+    return len;
+}
+
+/**
+ * \brief           Get size of memory for backtracking engine context with visited bitmap
+ *
+ * With visited bitmap, backtracking matching never tries the same pattern entry
+ * on the same input position twice and its time does not grow exponentially.
+ * Bitmap is used for every search of input up to `len` bytes, longer inputs are matched without it.
+ * For pattern with repeated groups, size is of stack which never exhausts on input up to `len` bytes
+ * and bitmap after it. Bitmap then helps only inside iterations of groups without maximum,
+ * repetitions of bounded groups such as `(a|aa){1,40}b` may still take exponential time.
+ *
+ * \note            Memory is given to \ref regex_set_engine or \ref regex_ctx_init
+ *                  with \ref REGEX_ENGINE_BACKTRACK engine
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       len: Maximal length of input buffer to use bitmap for
+ * \return          Memory size in units of bytes
+ */
+size_t
+regex_backtrack_mem_size(const regex_t* r, size_t len) {
+    if (r->loop_depth) {                        /* Stack depth grows with iterations, bitmap follows in whole frames */
+        return (BT_LOOP_FRAMES(r->p_len, r->loop_depth, len) + (BT_VISIT_MEM(r->p_len, len) + sizeof(bt_frame_t) - 1) / sizeof(bt_frame_t))
+               * sizeof(bt_frame_t) + NFA_ALIGN - 1;
+    }
+    return bt_mem(r) + NFA_ALIGN - 1 + BT_VISIT_MEM(r->p_len, len);
+}
+
+/**
+ * \brief           Initialize matching context for use with shared compiled regex
+ *
+ * Compiled regex is only read while matching with context,
+ * which makes it possible to match the same regex from multiple threads at once, each with its own context.
+ *
+ * \note            Engine must be selected before and must not change while context is used
+ * \param[out]      ctx: Pointer to matching context
+ * \param[in]       r: Regex structure with compiled pattern, must stay valid while context is used
+ * \param[in]       mem: Memory for state lists, backtracking stack and DFA cache, size given by \ref regex_ctx_mem_size.
+ *                      For \ref REGEX_ENGINE_BACKTRACK, memory of any size is used as backtracking stack,
+ *                      matching returns \ref REGEX_EXHAUSTED when it is full.
+ *                      Memory after the deepest stack is used as visited bitmap, see \ref regex_backtrack_mem_size.
+ *                      Can be `NULL` for \ref REGEX_ENGINE_BACKTRACK to use \ref REGEX_CFG_BT_STACK frames on call stack
+ * \param[in]       mem_len: Size of memory in units of bytes
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_ctx_init(regex_match_ctx_t* ctx, const regex_t* r, void* mem, size_t mem_len) {
+    if (r->engine != REGEX_ENGINE_BACKTRACK && (mem == NULL || mem_len < regex_ctx_mem_size(r, 2))) {
+        return 0;
+    }
+    ctx_setup(ctx, r, mem, mem_len);
+    return 1;
+}
+
+/**
+ * \brief           Check if input buffer and pattern matches, using matching context
+ * \note            Context is modified, but compiled regex is only read
+ * \param[in]       ctx: Matching context, initialized with \ref regex_ctx_init
+ * \param[in]       str: Pointer to input buffer to make match on
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `NULL` if not used.
+ *                      Number of valid entries is available in \ref regex_match_ctx_t.m_len after match
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_match_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, regex_match_t* matches, size_t m_len) {
+    return search(ctx, str, len, 0, len, 0, NULL, matches, m_len);
+}
+
+/**
+ * \brief           Check if input buffer and pattern matches with explicit match mode, using matching context
+ * \note            Context is modified, but compiled regex is only read, see \ref regex_match_mode
+ * \param[in]       ctx: Matching context, initialized with \ref regex_ctx_init
+ * \param[in]       str: Pointer to input buffer to make match on
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in]       mode: Match mode, combination of `REGEX_MODE_*` flags
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 on match, 0 otherwise, \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_match_mode_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, uint8_t mode, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    return search(ctx, str, len, 0, len, mode, span, matches, m_len);
+}
+
+/**
+ * \brief           Find next match in input buffer, using matching context
+ * \note            Context is modified, but compiled regex is only read, see \ref regex_find_next
+ * \param[in]       ctx: Matching context, initialized with \ref regex_ctx_init
+ * \param[in]       str: Pointer to input buffer, the same for all calls
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in,out]   pos: Offset to start search at, set to `0` before first call.
+ *                      Updated to resume position after the call
+ * \param[out]      span: Output for start and length of entire match. Set to `NULL` if not used
+ * \param[out]      matches: Array to write capturing groups to. Set to `NULL` if not used
+ * \param[in]       m_len: Number of entries in matches array
+ * \return          1 if match was found, 0 if there are no more matches,
+ *                      \ref REGEX_EXHAUSTED if backtracking stack is full
+ *                      or \ref REGEX_BUDGET_EXCEEDED if step budget is used up
+ */
+uint8_t
+regex_find_next_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, size_t* pos, regex_match_t* span, regex_match_t* matches, size_t m_len) {
+    return find_next(ctx, str, len, len, pos, span, matches, m_len);
+}
+
+/**
+ * \brief           Set step budget for searches with matching context
+ *
+ * Every pattern entry check and every backtrack of backtracking engine is one step.
+ * Search which needs more steps stops with \ref REGEX_BUDGET_EXCEEDED result,
+ * so patterns and inputs from untrusted sources cannot keep matching busy for long.
+ * Number of steps used by last search is available in \ref regex_match_ctx_t.steps.
+ * NFA and DFA engines run in linear time and use steps only when groups are recorded.
+ *
+ * \note            Budget is reset by \ref regex_set_engine and \ref regex_ctx_init, set it after them.
+ *                  Use `&r->ctx` for default context of regex
+ * \param[in]       ctx: Matching context
+ * \param[in]       steps: Maximal number of steps per search, `0` for no limit
+ */
+void
+regex_set_budget(regex_match_ctx_t* ctx, size_t steps) {
+    ctx->step_limit = steps;
+}
+
+/**
+ * \brief           Match many input buffers against the same pattern
+ *
+ * Matching state is set up once for all records and next record is prefetched while current one is matched.
+ * Capturing groups are not recorded, use \ref regex_match_n when they are needed.
+ *
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       strs: Array of `n` pointers to input buffers
+ * \param[in]       lens: Array of `n` buffer lengths. Set to `NULL` if buffers are NULL-terminated
+ * \param[in]       n: Number of records
+ * \param[out]      results: Array of `n` entries, set to `1` on match, `0` otherwise,
+ *                      \ref REGEX_EXHAUSTED or \ref REGEX_BUDGET_EXCEEDED when matching stopped
+ * \param[out]      spans: Array of `n` entries for start and length of match. Set to `NULL` if not used.
+ *                      Entry is set to `NULL` and `0` length when record does not match
+ * \return          Number of matched records
+ */
+size_t
+regex_match_batch(regex_t* r, const char* const* strs, const size_t* lens, size_t n, uint8_t* results, regex_match_t* spans) {
+    regex_match_ctx_t* ctx = &r->ctx;
+    const p_t* p = r->p;
+    regex_match_t* span = NULL;
+    size_t i, cnt = 0;
+    uint8_t anc;
+
+    anc = p->type == P_BEGIN ? (p++, 1) : 0;    /* Per-pattern setup is done only once */
+    ctx->matches = NULL;
+    ctx->m_totlen = 0;
+    ctx->m_len = 0;
+    ctx->mode = r->longest && spans != NULL ? REGEX_MODE_LONGEST : 0;
+    for (i = 0; i < n; i++) {
+        if (i + 1 < n) {                        /* Load next record while current one is matched */
+            REGEX_PREFETCH(strs[i + 1]);
+        }
+        ctx->end = strs[i] + (lens != NULL ? lens[i] : strlen(strs[i]));
+        ctx->m_last = ctx->end;
+        ctx->steps = 0;
+        if (spans != NULL) {
+            span = &spans[i];
+            span->s = NULL;
+            span->len = 0;
+        }
+        results[i] = search_at(ctx, p, anc, strs[i], span);
+        cnt += results[i] == 1;
+    }
+    ctx->mode = 0;
+    return cnt;
+}
+
+/**
+ * \brief           Prepare and compile set of patterns to be matched together in single pass
+ *
+ * Patterns are compiled one after another to the same array and share character classes.
+ * Engine for set is selected with \ref regex_set_engine, NFA and DFA engines match all patterns at once.
+ *
+ * \param[in]       r: Pointer to empty \ref regex_t structure for matching
+ * \param[in]       patterns: Array of pattern strings, pattern index is its ID in match result
+ * \param[in]       n: Number of patterns, at least `1`
+ * \param[in]       p: Pointer to array to hold patterns data of all patterns to
+ * \param[in]       p_len: Size of array for patterns
+ * \param[in]       c: Pointer to array to hold compiled character classes to
+ * \param[in]       c_len: Size of array for character classes
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_prepare_set(regex_t* r, const char* const* patterns, size_t n, regex_pattern_t* p, size_t p_len, regex_class_t* c, size_t c_len) {
+    const char* pattern;
+    size_t i, len, used = 0;
+    uint8_t fold;
+
+    r->c = c;                                   /* Save pointer to class array */
+    r->c_totlen = c_len;                        /* Save total length of class array */
+    r->c_len = 0;                               /* Reset number of currently used classes */
+    r->g_len = 0;                               /* Reset number of capturing groups */
+    r->loop_depth = 0;
+    r->engine = REGEX_ENGINE_BACKTRACK;         /* Use backtracking engine by default */
+    r->longest = 0;
+    r->nfa = NULL;
+    r->nfa_len = 0;
+    ctx_setup(&r->ctx, r, NULL, 0);
+
+    for (i = 0; i < n; i++) {                   /* Compile each pattern after previous one */
+        r->p = p + used;
+        r->p_totlen = p_len - used;
+        pattern = patterns[i];
+        if (!analyze_pattern(r, &pattern, &len, &fold)) {   /* Analyze pattern and make sure it is in correct format */
+            return 0;
+        }
+        if (!compile_pattern(r, pattern, len, fold)) {  /* Try to compile pattern */
+            return 0;
+        }
+        optimize_pattern(r);
+        used += r->p_len;
+    }
+    r->p = p;                                   /* Save pointer to pattern array */
+    r->p_totlen = p_len;                        /* Save total length of array available to use */
+    r->p_len = used;                            /* Save number of used patterns */
+    r->p_cnt = n;
+    if (!n) {
+        return 0;
+    }
+    compile_first(r);                           /* Prepare prefilters for search loop */
+    compile_required(r);
+    REGEX_DEBUG(r, REGEX_EVT_PREPARED, r->p, NULL);
+    return 1;
+}
+
+/**
+ * \brief           Match input buffer against all patterns of set
+ * \note            Capturing groups and match positions are not reported for pattern set
+ * \param[in]       r: Regex structure with compiled pattern set
+ * \param[in]       str: Pointer to input buffer to make match on
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[out]      ids: Bit array of `(n + 7) / 8` bytes, bit `id % 8` of byte `id / 8` is set for each matched pattern
+ * \return          Number of matched patterns
+ */
+size_t
+regex_match_set(regex_t* r, const char* str, size_t len, uint8_t* ids) {
+    regex_match_ctx_t* ctx = &r->ctx;
+    const p_t* p;
+    size_t i, found = 0;
+    uint8_t anc;
+
+    memset(ids, 0x00, (r->p_cnt + 7) / 8);
+    ctx->end = str + len;                       /* Set end of input */
+    ctx->m_last = ctx->end;
+    if (r->engine == REGEX_ENGINE_NFA) {        /* Match all patterns in single pass */
+        return nfa_match_set(ctx, str, ids);
+    } else if (r->engine == REGEX_ENGINE_DFA) {
+        return dfa_match_set(ctx, str, ids);
+    }
+
+    /* Backtracking engine matches patterns one by one, with shared step budget */
+    ctx->steps = 0;
+    ctx->matches = NULL;
+    ctx->m_totlen = 0;
+    ctx->m_len = 0;
+    for (i = 0, p = r->p; i < r->p_cnt; i++, p = next_pattern(p)) {
+        anc = p->type == P_BEGIN;
+        if (search_at(ctx, p + anc, anc, str, NULL) == 1) {
+            found += set_mark(ids, (uint32_t)i);
+        }
+    }
+    return found;
+}
+
+/**
+ * \brief           Export compiled pattern to self-contained image
+ *
+ * Image does not reference source pattern strings and can be stored to flash
+ * or file and loaded later with \ref regex_import, possibly by another build with the same byte order.
+ *
+ * \param[in]       r: Regex structure with compiled pattern or pattern set
+ * \param[out]      buf: Buffer to write image to. Set to `NULL` to get required size only
+ * \param[in]       len: Size of buffer in units of bytes
+ * \return          Size of image in units of bytes, `0` if buffer is too small
+ */
+size_t
+regex_export(const regex_t* r, void* buf, size_t len) {
+    image_hdr_t hdr;
+    image_entry_t e;
+    uint8_t* b = buf;
+    size_t i, size, pool, str = 0;
+
+    pool = sizeof(hdr) + r->p_len * sizeof(e) + r->c_len * sizeof(regex_class_t);
+    for (size = pool, i = 0; i < r->p_len; i++) {
+        size += IMAGE_STR(r->p[i].type) ? r->p[i].len : 0;
+    }
+    if (buf == NULL) {
+        return size;
+    } else if (len < size) {
+        return 0;
+    }
+
+    hdr.magic = IMAGE_MAGIC;
+    hdr.size = (uint32_t)size;
+    hdr.p_len = (uint32_t)r->p_len;
+    hdr.p_cnt = (uint32_t)r->p_cnt;
+    hdr.c_len = (uint32_t)r->c_len;
+    hdr.g_len = (uint32_t)r->g_len;
+    memcpy(b, &hdr, sizeof(hdr));
+    for (i = 0; i < r->p_len; i++) {            /* Write entries and copy strings to pool */
+        memset(&e, 0x00, sizeof(e));
+        e.cls = r->p[i].cls;
+        e.min = r->p[i].min;
+        e.max = r->p[i].max;
+        e.type = r->p[i].type;
+        e.len = r->p[i].len;
+        e.poss = r->p[i].poss;
+        if (IMAGE_STR(r->p[i].type)) {
+            e.str = (uint32_t)str;
+            memcpy(b + pool + str, r->p[i].str, r->p[i].len);
+            str += r->p[i].len;
+        } else {
+            e.str = (uint8_t)r->p[i].ch;
+        }
+        memcpy(b + sizeof(hdr) + i * sizeof(e), &e, sizeof(e));
+    }
+    memcpy(b + sizeof(hdr) + r->p_len * sizeof(e), r->c, r->c_len * sizeof(regex_class_t));
+    return size;
+}
+
+/**
+ * \brief           Load compiled pattern from image created by \ref regex_export
+ *
+ * Pattern is not parsed again. Class bitmaps and strings are used directly from image,
+ * which must stay valid while regex is used and may be placed in read-only memory.
+ * Only pattern entries are expanded to user array.
+ *
+ * \param[in]       r: Pointer to empty \ref regex_t structure for matching
+ * \param[in]       img: Pointer to image
+ * \param[in]       img_len: Size of image in units of bytes
+ * \param[in]       p: Pointer to array to hold patterns data to
+ * \param[in]       p_len: Size of array for patterns
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_import(regex_t* r, const void* img, size_t img_len, regex_pattern_t* p, size_t p_len) {
+    image_hdr_t hdr;
+    image_entry_t e;
+    const uint8_t* b = img;
+    size_t i, pool, loops;
+
+    if (img_len < sizeof(hdr)) {
+        return 0;
+    }
+    memcpy(&hdr, b, sizeof(hdr));
+    pool = sizeof(hdr) + (size_t)hdr.p_len * sizeof(e) + (size_t)hdr.c_len * sizeof(regex_class_t);
+    if (hdr.magic != IMAGE_MAGIC || hdr.size > img_len || pool > hdr.size
+        || !hdr.p_len || !hdr.p_cnt || hdr.p_len > p_len) {
+        return 0;
+    }
+    for (i = 0; i < hdr.p_len; i++) {           /* Expand entries, strings point to pool */
+        memcpy(&e, b + sizeof(hdr) + i * sizeof(e), sizeof(e));
+        memset(&p[i], 0x00, sizeof(p[i]));
+        p[i].cls = e.cls;
+        p[i].min = e.min;
+        p[i].max = e.max;
+        p[i].type = e.type;
+        p[i].len = e.len;
+        p[i].poss = e.poss;
+        if (IMAGE_STR(p[i].type)) {
+            if (pool + e.str + e.len > hdr.size) {
+                return 0;
+            }
+            p[i].str = (const char*)b + pool + e.str;
+        } else {
+            p[i].ch = (char)e.str;
+        }
+        if ((p[i].type == P_CHAR_CLASS || p[i].type == P_CHAR_CLASS_NOT) && e.cls >= hdr.c_len) {
+            return 0;                           /* Class index out of image */
+        }
+    }
+    if (p[hdr.p_len - 1].type != P_EMPTY) {
+        return 0;
+    }
+    r->loop_depth = 0;
+    for (i = 0, pool = 0; i < hdr.p_len; i++) { /* Offsets are not stored, groups of each pattern are linked again */
+        if ((!i || p[i - 1].type == P_EMPTY) && pool++ < hdr.p_cnt) {
+            if (!compile_links(&p[i], &loops)) {
+                return 0;
+            }
+            r->loop_depth = loops > r->loop_depth ? loops : r->loop_depth;
+        }
+    }
+    if (pool != hdr.p_cnt) {
+        return 0;
+    }
+
+    r->p = p;
+    r->p_totlen = p_len;
+    r->p_len = hdr.p_len;
+    r->p_cnt = hdr.p_cnt;
+    r->c = (regex_class_t*)(b + sizeof(hdr) + (size_t)hdr.p_len * sizeof(e));  /* Classes are only read */
+    r->c_len = r->c_totlen = hdr.c_len;
+    r->g_len = hdr.g_len;
+    r->engine = REGEX_ENGINE_BACKTRACK;
+    r->longest = 0;
+    r->nfa = NULL;
+    r->nfa_len = 0;
+    ctx_setup(&r->ctx, r, NULL, 0);
+    compile_first(r);                           /* Prefilters are derived from pattern list */
+    compile_required(r);
+    REGEX_DEBUG(r, REGEX_EVT_PREPARED, r->p, NULL);
+    return 1;
+}
+
+/**
+ * \brief           Get size of memory required for compiled pattern cache
+ * \param[in]       slots: Number of compiled patterns cache holds at the same time
+ * \param[in]       p_len: Number of pattern entries for each compiled pattern
+ * \param[in]       c_len: Number of character classes for each compiled pattern
+ * \param[in]       text_len: Maximal length of pattern text, including `/` and `/g`
+ * \return          Memory size in units of bytes
+ */
+size_t
+regex_cache_mem_size(size_t slots, size_t p_len, size_t c_len, size_t text_len) {
+    return NFA_ALIGN_UP(cache_buckets(slots) * sizeof(uint32_t)) + slots * CACHE_SLOT_SIZE(p_len, c_len, text_len) + NFA_ALIGN - 1;
+}
+
+/**
+ * \brief           Initialize cache of compiled patterns
+ *
+ * Patterns are looked up by their text with \ref regex_cache_get and compiled only on first use.
+ * When all slots are used, least recently used pattern is replaced.
+ *
+ * \note            Cache is not thread safe, lookups must be serialized by caller
+ * \param[out]      cache: Cache to initialize
+ * \param[in]       slots: Number of compiled patterns cache holds at the same time
+ * \param[in]       p_len: Number of pattern entries for each compiled pattern
+ * \param[in]       c_len: Number of character classes for each compiled pattern
+ * \param[in]       text_len: Maximal length of pattern text, longer patterns are not cached
+ * \param[in]       mem: Memory for cache, size given by \ref regex_cache_mem_size. Must stay valid while cache is used
+ * \param[in]       mem_len: Size of memory in units of bytes
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_cache_init(regex_cache_t* cache, size_t slots, size_t p_len, size_t c_len, size_t text_len, void* mem, size_t mem_len) {
+    size_t i;
+
+    if (mem == NULL || !slots || slots >= 0xFFFFFFFFUL || mem_len < regex_cache_mem_size(slots, p_len, c_len, text_len)) {
+        return 0;
+    }
+    memset(cache, 0x00, sizeof(*cache));
+    cache->buckets = (uint32_t*)NFA_ALIGN_UP((uintptr_t)mem);
+    cache->buckets_len = cache_buckets(slots);
+    memset(cache->buckets, 0x00, cache->buckets_len * sizeof(uint32_t));
+    cache->mem = (uint8_t*)cache->buckets + NFA_ALIGN_UP(cache->buckets_len * sizeof(uint32_t));
+    cache->slot_size = CACHE_SLOT_SIZE(p_len, c_len, text_len);
+    cache->slots = slots;
+    cache->p_len = p_len;
+    cache->c_len = c_len;
+    cache->text_len = text_len;
+    for (i = slots; i > 0; i--) {               /* All slots are free, lowest index is used first */
+        CACHE_SLOT(cache, i)->next = cache->free;
+        cache->free = (uint32_t)i;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get compiled pattern from cache, pattern is compiled on first use
+ *
+ * Returned pattern is shared by all lookups of the same text and can be used with all match functions.
+ * Pattern is valid until its slot is reused for another pattern, on a later miss with full cache.
+ * Use \ref regex_ctx_init contexts to match with the same pattern on many threads.
+ *
+ * \param[in]       cache: Cache initialized with \ref regex_cache_init
+ * \param[in]       pattern: Pattern string, the same format as for \ref regex_prepare. It is copied to cache
+ * \return          Compiled pattern, `NULL` if pattern is not valid or it is too long for cache slot
+ */
+regex_t*
+regex_cache_get(regex_cache_t* cache, const char* pattern) {
+    cache_slot_t* sl;
+    uint32_t hash = 2166136261UL, i;
+    size_t len;
+    char* text;
+
+    for (len = 0; pattern[len]; len++) {        /* Length is computed while hashing */
+        hash = (hash ^ (uint8_t)pattern[len]) * 16777619UL;
+    }
+    for (i = cache->buckets[hash & (cache->buckets_len - 1)]; i; i = sl->chain) {
+        sl = CACHE_SLOT(cache, i);
+        if (sl->hash == hash && sl->len == len && !memcmp(CACHE_SLOT_TEXT(cache, sl), pattern, len)) {
+            cache->hits++;
+            cache_lru_remove(cache, i);
+            cache_lru_insert(cache, i);
+            return &sl->r;
+        }
+    }
+
+    cache->misses++;
+    if (len > cache->text_len) {
+        return NULL;
+    }
+    if (cache->free) {                          /* Take free slot or replace least recently used one */
+        i = cache->free;
+        cache->free = CACHE_SLOT(cache, i)->next;
+    } else {
+        i = cache_evict(cache);
+    }
+    sl = CACHE_SLOT(cache, i);
+    text = CACHE_SLOT_TEXT(cache, sl);
+    memcpy(text, pattern, len + 1);
+    if (!regex_prepare(&sl->r, text, CACHE_SLOT_P(sl), cache->p_len, CACHE_SLOT_C(cache, sl), cache->c_len)) {
+        sl->next = cache->free;                 /* Invalid pattern is not cached */
+        cache->free = i;
+        return NULL;
+    }
+    sl->hash = hash;
+    sl->len = len;
+    sl->chain = cache->buckets[hash & (cache->buckets_len - 1)];
+    cache->buckets[hash & (cache->buckets_len - 1)] = i;
+    cache_lru_insert(cache, i);
+    return &sl->r;
+}
+
+/**
+ * \brief           Get size of memory required for streaming context
+ * \note            Engine must be selected before, see \ref regex_stream_init
+ * \param[in]       r: Regex structure with compiled pattern
+ * \return          Memory size in units of bytes
+ */
+size_t
+regex_stream_mem_size(const regex_t* r) {
+    return NFA_ALIGN_UP(nfa_lists_mem(r->nfa_len)) + REGEX_CFG_STREAM_PENDING * 2 * sizeof(size_t) + NFA_ALIGN - 1;
+}
+
+/**
+ * \brief           Initialize streaming context for matching input delivered in chunks
+ *
+ * Callback is called in the same order and with the same spans as with \ref regex_find_next loop
+ * over entire stream, matches are leftmost-longest and do not overlap.
+ * Match is reported when no thread which started before or with it can still match,
+ * at the latest by \ref regex_stream_finish.
+ * Memory use does not depend on length of stream. Up to \ref REGEX_CFG_STREAM_PENDING matches
+ * wait for unfinished earlier thread, then the oldest one is reported and that thread is given up.
+ *
+ * \note            Regex must have single pattern and \ref REGEX_ENGINE_NFA or \ref REGEX_ENGINE_DFA engine selected.
+ *                  Streaming uses NFA program, as DFA states do not keep start of match
+ * \param[in]       st: Pointer to streaming context
+ * \param[in]       r: Regex structure with compiled pattern, must stay valid while stream is used
+ * \param[in]       mem: Memory for state lists, size given by \ref regex_stream_mem_size
+ * \param[in]       mem_len: Size of memory in units of bytes
+ * \param[in]       fn: Callback function called for each match
+ * \param[in]       arg: User argument passed to callback function
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+regex_stream_init(regex_stream_t* st, const regex_t* r, void* mem, size_t mem_len, regex_stream_fn fn, void* arg) {
+    if (r->nfa == NULL || r->p_cnt != 1 || fn == NULL || mem == NULL || mem_len < regex_stream_mem_size(r)) {
+        return 0;
+    }
+    st->r = r;
+    st->mem = (void*)NFA_ALIGN_UP((uintptr_t)mem);
+    memset(st->mem, 0x00, nfa_lists_mem(r->nfa_len));  /* Sparse arrays are cleared once */
+    st->pend = (size_t*)((uint8_t*)st->mem + NFA_ALIGN_UP(nfa_lists_mem(r->nfa_len)));
+    st->pend_len = 0;
+    st->len = 0;
+    st->cur = 0;
+    st->off = 0;
+    st->fn = fn;
+    st->arg = arg;
+    return 1;
+}
+
+/**
+ * \brief           Process next chunk of input stream
+ * \note            Match may span over multiple chunks, it is reported when no longer or earlier match can follow
+ * \param[in]       st: Pointer to streaming context
+ * \param[in]       chunk: Pointer to input bytes
+ * \param[in]       len: Number of bytes in chunk
+ * \return          Number of matches reported during this call
+ */
+size_t
+regex_stream_feed(regex_stream_t* st, const char* chunk, size_t len) {
+    const regex_t* r = st->r;
+    nfa_list_t l[2];
+    const char* s = chunk, *end = chunk + len, *n;
+    uint32_t* stack;
+    size_t cnt = 0;
+
+    stack = nfa_lists_at(st->mem, r->nfa_len, l);
+    l[st->cur].len = st->len;
+    while (s < end) {
+        if (!l[st->cur].len) {                  /* No active match */
+            if (st->off && r->nfa_start == NFA_NONE) {  /* Anchored pattern cannot match anymore */
+                st->off += (size_t)(end - s);
+                break;
+            } else if (r->first_cnt) {          /* Skip to next possible start of match */
+                if ((n = prefilter_first(r, s, end, end)) == NULL) {  /* Prefilter searches only current chunk */
+                    n = end;
+                    if (r->prefix_len > 1) {    /* Prefix may continue in next chunk */
+                        n = (size_t)(end - s) >= r->prefix_len ? end - r->prefix_len + 1 : s;
+                    }
+                }
+                st->off += (size_t)(n - s);
+                if ((s = n) == end) {
+                    break;
+                }
+            }
+        }
+        cnt += nfa_stream_step(st, l, stack, s++);
+    }
+    st->len = l[st->cur].len;
+    return cnt;
+}
+
+/**
+ * \brief           Finish input stream and report all pending matches, also those ending at the end of stream
+ * \note            Context is reset and can be used for new stream after this call
+ * \param[in]       st: Pointer to streaming context
+ * \return          Number of matches reported during this call
+ */
+size_t
+regex_stream_finish(regex_stream_t* st) {
+    nfa_list_t l[2];
+    uint32_t* stack;
+    size_t cnt;
+
+    stack = nfa_lists_at(st->mem, st->r->nfa_len, l);
+    l[st->cur].len = st->len;
+    cnt = nfa_stream_step(st, l, stack, NULL);
+    st->len = 0;
+    st->cur = 0;
+    st->off = 0;
+    return cnt;
+}
+
+/**
+ * \brief           Set parallel search configuration to default values
+ * \param[out]      cfg: Configuration to initialize
+ */
+void
+regex_parallel_init(regex_parallel_t* cfg) {
+    cfg->workers = 4;
+    cfg->chunk_size = 64 * 1024;
+    cfg->delim = '\n';
+    cfg->chunk_matches = 64;
+    cfg->exec = NULL;
+    cfg->exec_arg = NULL;
+}
+
+/**
+ * \brief           Get size of memory required for parallel search
+ * \note            Engine must be selected before, see \ref regex_search_parallel
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       cfg: Parallel search configuration. Set to `NULL` for default configuration
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \return          Memory size in units of bytes
+ */
+size_t
+regex_parallel_mem_size(const regex_t* r, const regex_parallel_t* cfg, size_t len) {
+    regex_parallel_t def;
+    size_t chunks;
+
+    if (cfg == NULL) {
+        regex_parallel_init(&def);
+        cfg = &def;
+    }
+    chunks = len / (cfg->chunk_size ? cfg->chunk_size : 1) + 1;
+    return NFA_ALIGN_UP(chunks * sizeof(par_chunk_t))
+           + NFA_ALIGN_UP(chunks * cfg->chunk_matches * sizeof(regex_match_t))
+           + NFA_ALIGN_UP(cfg->workers * sizeof(regex_match_ctx_t))
+           + cfg->workers * par_ctx_mem_size(r) + NFA_ALIGN - 1;
+}
+
+/**
+ * \brief           Find all matches in input buffer, using multiple workers
+ *
+ * Buffer is split to chunks at boundary bytes, chunks are searched by executor
+ * and matches are reported in the same order and with the same spans as with \ref regex_find_next loop.
+ * Callback is called on calling thread, after all chunks are searched.
+ *
+ * \note            Compiled regex is only read, each worker uses its own matching context in provided memory
+ * \param[in]       r: Regex structure with compiled pattern, single pattern only
+ * \param[in]       cfg: Parallel search configuration. Set to `NULL` for default configuration
+ * \param[in]       str: Pointer to input buffer
+ * \param[in]       len: Length of input buffer in units of bytes
+ * \param[in]       mem: Memory for chunks and worker contexts, size given by \ref regex_parallel_mem_size
+ * \param[in]       mem_len: Size of memory in units of bytes
+ * \param[in]       fn: Callback function called for each match, with offset of match in buffer
+ * \param[in]       arg: User argument passed to callback function
+ * \return          1 on success, 0 on invalid parameters or when matching stopped after reporting earlier matches
+ */
+uint8_t
+regex_search_parallel(const regex_t* r, const regex_parallel_t* cfg, const char* str, size_t len, void* mem, size_t mem_len, regex_stream_fn fn, void* arg) {
+    regex_parallel_t def;
+    par_job_t pj;
+    uint8_t* m;
+    size_t i, n, ctx_mem;
+
+    if (cfg == NULL) {
+        regex_parallel_init(&def);
+        cfg = &def;
+    }
+    if (r->p_cnt != 1 || !cfg->workers || !cfg->chunk_size || fn == NULL
+        || mem == NULL || mem_len < regex_parallel_mem_size(r, cfg, len)) {
+        return 0;
+    }
+
+    /* Set up chunks, match buffers and worker contexts in user memory */
+    m = (uint8_t*)NFA_ALIGN_UP((uintptr_t)mem);
+    pj.str = str;
+    pj.len = len;
+    pj.chunks = (par_chunk_t*)m;
+    n = par_plan(cfg, str, len, pj.chunks);
+    m += NFA_ALIGN_UP((len / cfg->chunk_size + 1) * sizeof(par_chunk_t));
+    pj.m = (regex_match_t*)m;
+    pj.m_len = cfg->chunk_matches;
+    m += NFA_ALIGN_UP((len / cfg->chunk_size + 1) * cfg->chunk_matches * sizeof(regex_match_t));
+    pj.ctx = (regex_match_ctx_t*)m;
+    m += NFA_ALIGN_UP(cfg->workers * sizeof(regex_match_ctx_t));
+    ctx_mem = par_ctx_mem_size(r);
+    for (i = 0; i < cfg->workers; i++, m += ctx_mem) {
+        ctx_setup(&pj.ctx[i], r, m, ctx_mem);
+    }
+
+    if (cfg->exec != NULL) {
+        cfg->exec(cfg->exec_arg, n, cfg->workers, par_job, &pj);
+    } else {
+        par_exec(NULL, n, cfg->workers, par_job, &pj);
+    }
+    return par_merge(&pj, n, fn, arg);
+}
+
+/**
+ * \brief           Get size of memory required for \ref REGEX_ENGINE_NFA engine
+ * \param[in]       r: Regex structure with compiled pattern
+ * \return          Memory size in units of bytes, `0` if repetitions are too big for NFA program
+ */
+size_t
+regex_nfa_mem_size(const regex_t* r) {
+    if (!nfa_fits(r)) {
+        return 0;
+    }
+
+    /* Program, 2 sparse sets with 2 arrays each and backtracking stack, with alignment reserve */
+    return nfa_mem(nfa_compile(r, NULL, NULL)) + bt_mem(r) + NFA_ALIGN - 1;
+}
+
+/**
+ * \brief           Get size of memory required for \ref REGEX_ENGINE_DFA engine
+ * \note            Cache may hold more states than requested, when sets of active instructions are small
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       states: Number of DFA states cache must be able to hold in any case, minimum is `2`
+ * \return          Memory size in units of bytes, including NFA memory, `0` if repetitions are too big for NFA program
+ */
+size_t
+regex_dfa_mem_size(const regex_t* r, size_t states) {
+    if (!nfa_fits(r)) {
+        return 0;
+    }
+    states = states < 2 ? 2 : states;
+    return regex_nfa_mem_size(r) + (DFA_HASH_SIZE + states * DFA_STATE_WORDS(nfa_compile(r, NULL, NULL))) * sizeof(uint32_t);
+}
+
+/**
+ * \brief           Select matching engine for compiled pattern
+ * \note            Must be called after \ref regex_prepare, memory must stay valid while regex is used
+ * \param[in]       r: Regex structure with compiled pattern
+ * \param[in]       engine: Engine to use, member of \ref regex_engine_t
+ * \param[in]       mem: Memory for NFA program, state lists and backtracking stack, size given by \ref regex_nfa_mem_size.
+ *                      For \ref REGEX_ENGINE_DFA, remaining memory is used as state cache, see \ref regex_dfa_mem_size.
+ *                      For \ref REGEX_ENGINE_BACKTRACK, memory of any size is used as backtracking stack,
+ *                      see \ref regex_ctx_mem_size, and as visited bitmap, see \ref regex_backtrack_mem_size.
+ *                      Can be `NULL` to use \ref REGEX_CFG_BT_STACK frames on call stack.
+ *                      Groups of NFA and DFA matches are recorded with stack for pattern length,
+ *                      iterations of repeated groups may exhaust it, see \ref REGEX_EXHAUSTED.
+ *                      For \ref REGEX_ENGINE_NFA, stack of pattern with repeated groups uses all remaining memory
+ * \param[in]       mem_len: Size of memory in units of bytes
+ * \return          1 on success, 0 otherwise or when \ref REGEX_ENGINE_NFA or \ref REGEX_ENGINE_DFA
+ *                      is selected for pattern with possessive quantifier, such as `a++`,
+ *                      or with repetitions too big for NFA program
+ */
+uint8_t
+regex_set_engine(regex_t* r, regex_engine_t engine, void* mem, size_t mem_len) {
+    uint8_t* lists = NULL;
+    size_t i, len;
+    uint8_t longest = engine != REGEX_ENGINE_BACKTRACK;
+
+    for (i = 0; i < r->p_len && r->p[i].poss != POSS_SYNTAX; i++) {}
+    if (i < r->p_len || !nfa_fits(r)) {         /* Possessive quantifiers and huge repetitions are only matched by backtracking */
+        if (engine == REGEX_ENGINE_NFA || engine == REGEX_ENGINE_DFA) {
+            return 0;
+        }
+        engine = REGEX_ENGINE_BACKTRACK;
+    }
+    if (engine == REGEX_ENGINE_AUTO) {          /* Backtracking is fast for patterns without repetitions */
+        engine = REGEX_ENGINE_BACKTRACK;
+        if (mem != NULL && mem_len >= regex_nfa_mem_size(r)) {
+            for (i = 0; r->p[i].type != P_EMPTY && !r->p[i].min && !r->p[i].max; i++) {}
+            if (r->p[i].type != P_EMPTY || r->p_cnt > 1) {  /* Repetition found or set is matched in single pass */
+                engine = mem_len >= regex_dfa_mem_size(r, 2) ? REGEX_ENGINE_DFA : REGEX_ENGINE_NFA;
+            }
+        }
+    }
+    if (engine == REGEX_ENGINE_NFA || engine == REGEX_ENGINE_DFA) {
+        if (mem == NULL || mem_len < (engine == REGEX_ENGINE_DFA ? regex_dfa_mem_size(r, 2) : regex_nfa_mem_size(r))) {
+            return 0;
+        }
+        len = nfa_compile(r, NULL, NULL);
+        r->nfa = (void*)NFA_ALIGN_UP((uintptr_t)mem);
+        r->nfa_len = len;
+        nfa_compile(r, r->nfa, &r->nfa_start);
+        lists = (uint8_t*)r->nfa + NFA_ALIGN_UP(len * sizeof(nfa_inst_t));
+    } else {
+        lists = mem;                            /* Memory is only used for backtracking stack */
+    }
+    r->engine = engine;
+    r->longest = longest;                       /* Spans do not depend on engine selected by auto mode */
+
+    /* Default context uses remaining memory after program */
+    ctx_setup(&r->ctx, r, lists, lists != NULL ? mem_len - (size_t)(lists - (uint8_t*)mem) : 0);
+    return 1;
+}
+
+#if REGEX_CFG_STATS || __DOXYGEN__
+
+/**
+ * \brief           Get profiling counters of matching context
+ *
+ * Counters are accumulated over all searches with context since it was set up
+ * with \ref regex_set_engine or \ref regex_ctx_init, or since last \ref regex_stats_reset.
+ * Fast paths which are never taken show up as zero counters, for example `dfa_hits` with high `dfa_misses`.
+ *
+ * \note            Use `&r->ctx` for default context of regex
+ * \param[in]       ctx: Matching context
+ * \param[out]      stats: Output for counters
+ */
+void
+regex_stats_get(const regex_match_ctx_t* ctx, regex_stats_t* stats) {
+    *stats = ctx->stats;
+}
+
+/**
+ * \brief           Reset profiling counters of matching context
+ * \param[in]       ctx: Matching context
+ */
+void
+regex_stats_reset(regex_match_ctx_t* ctx) {
+    memset(&ctx->stats, 0x00, sizeof(ctx->stats));
+}
+
+#endif /* REGEX_CFG_STATS || __DOXYGEN__ */
+
+#if REGEX_CFG_DEBUG || __DOXYGEN__
+
+/**
+ * \brief           Register debug callback for compilation and matching events
+ * \param[in]       fn: Callback function or `NULL` to disable tracing
+ */
+void
+regex_debug_register(regex_debug_fn fn) {
+    debug_fn = fn;
+}
+
+/**
+ * \brief           Print compiled pattern list to standard output
+ * \note            Can be called from debug callback on \ref REGEX_EVT_PREPARED event
+ * \param[in]       r: Regex structure with compiled pattern
+ */
+void
+regex_debug_print_pattern(const regex_t* r) {
+    size_t i = 0, len;
+
+    for (; r->p[i].type != P_EMPTY; i++) {
+        switch (r->p[i].type) {
+            case P_CHAR_CLASS:
+            case P_CHAR_CLASS_NOT:
+                printf("Char class: \"");
+                for (len = 0; len < r->p[i].len; len++) {
+                    printf("%c", r->p[i].str[len]);
+                }
+                printf("\"; Min: %lu, Max: %lu\r\n", (unsigned long)r->p[i].min, (unsigned long)r->p[i].max);
+                break;
+            case P_CHAR_SEQUENCE:
+            case P_CHAR_SEQUENCE_FOLD:
+                printf("Char sequence%s: \"", r->p[i].type == P_CHAR_SEQUENCE_FOLD ? " (any case)" : "");
+                for (len = 0; len < r->p[i].len; len++) {
+                    printf("%c", r->p[i].str[len]);
+                }
+                printf("\"; Min: %lu, Max: %lu\r\n", (unsigned long)r->p[i].min, (unsigned long)r->p[i].max);
+                break;
+            case P_CHAR:
+                printf("Char: %c; Min: %lu, Max: %lu\r\n", r->p[i].ch, (unsigned long)r->p[i].min, (unsigned long)r->p[i].max);
+                break;
+            case P_OR:
+                printf("OR\r\n");
+                break;
+            case P_CAPTURE_START:
+                printf("CAPTURE_START\r\n");
+                break;
+            case P_CAPTURE_END:
+                printf("CAPTURE_END\r\n");
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+#endif /* REGEX_CFG_DEBUG || __DOXYGEN__ */
\ No newline at end of file
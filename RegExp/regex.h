@@ -42,6 +42,101 @@ extern "C" {
 #include "string.h"
 #include "stdint.h"
 #include "stdio.h"
+#include "stddef.h"
+
+/**
+ * \defgroup        RegExp_CONFIG Configuration
+ * \brief           Compile-time library configuration
+ * \{
+ */
+
+/**
+ * \brief           Enables (1) or disables (0) debug tracing with user callback
+ * \note            When disabled, there is no tracing code in matching path
+ */
+#ifndef REGEX_CFG_DEBUG
+#define REGEX_CFG_DEBUG                         0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) profiling counters in matching context
+ * \note            When disabled, there is no counting code in matching path, see \ref regex_stats_get
+ */
+#ifndef REGEX_CFG_STATS
+#define REGEX_CFG_STATS                         0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) SSE2/NEON vector search kernels
+ *
+ * Kernels search for first bytes of match and consume runs of repeated character or class.
+ * Class runs need SSSE3 on x86 targets.
+ *
+ * \note            Scalar implementation is used when target does not support them
+ */
+#ifndef REGEX_CFG_SIMD
+#define REGEX_CFG_SIMD                          1
+#endif
+
+/**
+ * \brief           Number of backtracking stack frames reserved on call stack
+ * \note            Used only when matching context has no backtracking stack memory,
+ *                  see \ref regex_set_engine and \ref regex_ctx_init
+ */
+#ifndef REGEX_CFG_BT_STACK
+#define REGEX_CFG_BT_STACK                      32
+#endif
+
+/**
+ * \brief           Maximal nesting depth of groups in pattern
+ * \note            Compilation and matching engines recurse once per nesting level
+ */
+#ifndef REGEX_CFG_GROUP_DEPTH
+#define REGEX_CFG_GROUP_DEPTH                   32
+#endif
+
+/**
+ * \brief           Maximal number of stream matches waiting for unfinished thread which started before them
+ * \note            When limit is reached, the oldest match is reported and that thread is given up
+ */
+#ifndef REGEX_CFG_STREAM_PENDING
+#define REGEX_CFG_STREAM_PENDING                16
+#endif
+
+/**
+ * \brief           Maximal number of open iterations of repeated groups in compile-time pattern of C++ layer
+ * \note            Each iteration is one level of native recursion, match stops with \ref REGEX_EXHAUSTED when limit is reached
+ */
+#ifndef REGEX_CFG_HPP_LOOP_DEPTH
+#define REGEX_CFG_HPP_LOOP_DEPTH                1024
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) built-in POSIX threads executor for parallel search
+ * \note            When disabled, built-in executor processes all chunks on calling thread
+ */
+#ifndef REGEX_CFG_PARALLEL_PTHREAD
+#define REGEX_CFG_PARALLEL_PTHREAD              0
+#endif
+
+/**
+ * \brief           Maximal number of threads used by built-in parallel executor, including calling thread
+ */
+#ifndef REGEX_CFG_PARALLEL_MAX_THREADS
+#define REGEX_CFG_PARALLEL_MAX_THREADS          16
+#endif
+
+/**
+ * \}
+ */
+
+#define REGEX_EXHAUSTED                         2       /*!< Match result when backtracking stack is full */
+#define REGEX_BUDGET_EXCEEDED                   3       /*!< Match result when step budget is used up, see \ref regex_set_budget */
+
+#define REGEX_MODE_ANCHORED_START               0x01    /*!< Match must start at the beginning of input, see \ref regex_match_mode */
+#define REGEX_MODE_FULL_MATCH                   0x02    /*!< Match must cover entire input, implies \ref REGEX_MODE_ANCHORED_START */
+#define REGEX_MODE_EXISTS                       0x04    /*!< Only check if match exists, span and groups are not computed */
+#define REGEX_MODE_LONGEST                      0x08    /*!< Report longest match of leftmost start, also by backtracking engine */
 
 /**
  * \brief           List of possible regex pattern types
@@ -60,8 +155,17 @@ typedef enum {
     P_EMPTY,                                    /*!< Indicate end of pattern */
     P_CAPTURE_START,                            /*!< Start of capturing group */
     P_CAPTURE_END,                              /*!< End of capturing group */
+    P_CHAR_SEQUENCE_FOLD,                       /*!< Sequence of literal characters with letters, compared case-insensitively */
 } regex_pattern_type_t;
 
+/**
+ * \brief           Compiled character class as 256-bit membership set
+ * \note            Negation is already applied during compilation
+ */
+typedef struct {
+    uint8_t set[32];                            /*!< One bit per input byte, set when byte is member of class */
+} regex_class_t;
+
 /**
  * \brief           Information about single pattern after compilation
  */
@@ -69,12 +173,32 @@ typedef struct {
     union {
         const char* str;                        /*!< Pointer to string in source pattern */
         char ch;                                /*!< Character used for repetition */
+        uint32_t alt;                           /*!< Offset to next OR of the same group, 0 if none, valid only for capture start and OR */
+    };
+    uint32_t len;                               /*!< Length of string in source pattern, offset to group end (to group start for capture end) */
+    uint32_t min, max;                          /*!< Minimal or maximal readings, maximal `0xFFFFFFFF` means no limit, capture end holds group repetitions */
+    union {
+        uint16_t cls;                           /*!< Index of compiled class in \ref regex_t class array, valid only for character classes */
+        uint16_t grp;                           /*!< Index of capturing group or `0xFFFF` for internal group, valid only for capture start and end */
     };
-    uint8_t len;                                /*!< Length of string in source pattern, valid only if string is used */
-    regex_pattern_type_t type;                  /*!< Pattern type */
-    int16_t min, max;                           /*!< Minimal or maximal readings */
+    uint8_t type;                               /*!< Pattern type, member of \ref regex_pattern_type_t */
+    uint8_t poss;                               /*!< Set when repetitions are possessive and matched without backtracking */
 } regex_pattern_t;
 
+/**
+ * \brief           List of matching engines
+ *
+ * All engines except \ref REGEX_ENGINE_BACKTRACK report leftmost-longest match span, also when groups
+ * are recorded by backtracking. Results of \ref REGEX_ENGINE_AUTO do not depend on engine it selects or on memory given to it.
+ * \ref REGEX_ENGINE_BACKTRACK reports leftmost match with repetitions stopped as soon as rest of pattern matches.
+ */
+typedef enum {
+    REGEX_ENGINE_BACKTRACK,                     /*!< Backtracking engine with explicit stack of \ref REGEX_CFG_BT_STACK frames or frames in given memory, default after \ref regex_prepare */
+    REGEX_ENGINE_NFA,                           /*!< State-set (Pike VM) engine, match time is linear in pattern and input length */
+    REGEX_ENGINE_DFA,                           /*!< Lazily built DFA on top of NFA program, with state cache in user memory */
+    REGEX_ENGINE_AUTO,                          /*!< Backtracking for patterns without repetitions, DFA or NFA otherwise, depending on memory, with the same results */
+} regex_engine_t;
+
 /**
  * \brief           Structure holding single capturing group
  */
@@ -83,26 +207,258 @@ typedef struct {
     size_t len;                                 /*!< Length of string after match */
 } regex_match_t;
 
+struct regex_s;
+
+#if REGEX_CFG_STATS || __DOXYGEN__
+
 /**
- * \brief           Main structure used between matches engine
+ * \brief           Profiling counters of matching context
  */
 typedef struct {
-    regex_pattern_t* p;                         /*!< Pointer to array of patterns */
-    size_t p_len;                               /*!< Length of patterns used after compilation */
-    size_t p_totlen;                            /*!< Total length of patterns array */
+    size_t starts;                              /*!< Start positions tried by backtracking engine */
+    size_t attempts;                            /*!< Attempts to match rest of pattern by backtracking engine */
+    size_t backtracks;                          /*!< Failed attempts, next alternative or repetition was tried after them */
+    size_t class_tests;                         /*!< Character class tests of backtracking engine */
+    size_t prefilter_rejects;                   /*!< Searches rejected by required literal without running any engine */
+    size_t dfa_hits;                            /*!< DFA transitions taken from state cache */
+    size_t dfa_misses;                          /*!< DFA transitions computed and added to state cache */
+    size_t dfa_flushes;                         /*!< DFA state cache flushes */
+} regex_stats_t;
+
+#endif /* REGEX_CFG_STATS || __DOXYGEN__ */
+
+/**
+ * \brief           Matching context with per-call state and engine scratch memory
+ *
+ * Compiled pattern in \ref regex_t is only read during matching,
+ * so one compiled pattern can be used by many threads at once, each with its own context.
+ */
+typedef struct {
+    const struct regex_s* r;                    /*!< Regex with compiled pattern context belongs to */
 
     regex_match_t* matches;                     /*!< Pointer to array of matches */
     size_t m_len;                               /*!< Number of matches used so far */
     size_t m_totlen;                            /*!< Total length of matches array */
+
+    const char* end;                            /*!< Pointer to first byte after input string */
+    const char* m_last;                         /*!< Last input position match may start at, end of input unless search is limited */
+    const char* m_end;                          /*!< Pointer to end of match found by backtracking engine */
+    const char* m_req;                          /*!< Position where match must end, `NULL` if it may end anywhere */
+    const char* m_best;                         /*!< End of longest match found so far by backtracking engine, `NULL` if none */
+    uint8_t mode;                               /*!< Match mode of current search, combination of `REGEX_MODE_*` flags */
+
+    void* bt;                                   /*!< Pointer to backtracking stack, `NULL` to use stack frames on call stack */
+    size_t bt_len;                              /*!< Number of frames in backtracking stack */
+    uint8_t* visit;                             /*!< Pointer to visited bitmap memory of backtracking engine, `NULL` if not available */
+    size_t visit_len;                           /*!< Size of visited bitmap memory in units of bytes */
+    const char* visit_s;                        /*!< Input position of first bitmap column, `NULL` when bitmap is not used by current search */
+    size_t steps;                               /*!< Number of backtracking steps used by last search */
+    size_t step_limit;                          /*!< Maximal number of backtracking steps per search, `0` for no limit */
+
+    void* lists;                                /*!< Pointer to NFA state lists, used by \ref REGEX_ENGINE_NFA and \ref REGEX_ENGINE_DFA */
+    uint32_t* dfa;                              /*!< Pointer to DFA state cache, used by \ref REGEX_ENGINE_DFA */
+    size_t dfa_len;                             /*!< Size of DFA state cache in units of 32-bit words */
+    size_t dfa_used;                            /*!< Number of used words in DFA state cache */
+    uint32_t dfa_start;                         /*!< Cache offset of start state + 1, 0 if not built */
+    uint32_t dfa_idle;                          /*!< Cache offset of state without active match + 1, 0 if not built */
+    uint32_t dfa_flushes;                       /*!< Number of DFA state cache flushes */
+
+#if REGEX_CFG_STATS || __DOXYGEN__
+    regex_stats_t stats;                        /*!< Profiling counters, see \ref regex_stats_get */
+#endif /* REGEX_CFG_STATS || __DOXYGEN__ */
+} regex_match_ctx_t;
+
+/**
+ * \brief           Main structure used between matches engine
+ */
+typedef struct regex_s {
+    regex_pattern_t* p;                         /*!< Pointer to array of patterns */
+    size_t p_len;                               /*!< Length of patterns used after compilation */
+    size_t p_totlen;                            /*!< Total length of patterns array */
+    size_t p_cnt;                               /*!< Number of patterns compiled to array, more than 1 for pattern set */
+
+    regex_class_t* c;                           /*!< Pointer to array of compiled character classes */
+    size_t c_len;                               /*!< Number of character classes used after compilation */
+    size_t c_totlen;                            /*!< Total length of character classes array */
+    size_t g_len;                               /*!< Number of capturing groups in pattern */
+    size_t loop_depth;                          /*!< Nesting depth of repeated groups, 0 if pattern has none */
+
+    regex_engine_t engine;                      /*!< Engine used for matching */
+    uint8_t longest;                            /*!< Set when backtracking reports leftmost-longest span, as NFA and DFA engines do */
+    void* nfa;                                  /*!< Pointer to NFA program, used by \ref REGEX_ENGINE_NFA and \ref REGEX_ENGINE_DFA */
+    size_t nfa_len;                             /*!< Number of instructions in NFA program */
+    uint32_t nfa_start;                         /*!< NFA instruction starting match after first input position */
+
+    regex_class_t first;                        /*!< Set of bytes every match starts with */
+    uint16_t first_cnt;                         /*!< Number of bytes in first set, 0 if search cannot skip positions */
+    char first_ch[4];                           /*!< First bytes of first set, used for vector search */
+    const char* prefix;                         /*!< Pointer to literal prefix of every match in source pattern */
+    size_t prefix_len;                          /*!< Length of literal prefix, 0 if not available */
+    const char* req;                            /*!< Pointer to literal every match must contain in source pattern */
+    size_t req_len;                             /*!< Length of required literal, 0 if not available */
+    size_t req_dist;                            /*!< Maximal offset of required literal from match start, `(size_t)-1` if not bounded */
+    uint8_t req_fold;                           /*!< Set when required literal is compared case-insensitively */
+    uint8_t req_skip[256];                      /*!< Boyer-Moore-Horspool skip table for required literal */
+
+    regex_match_ctx_t ctx;                      /*!< Default context, used by functions without context parameter */
 } regex_t;
 
+/**
+ * \brief           Stream match callback function
+ * \param[in]       arg: User argument given to \ref regex_stream_init
+ * \param[in]       start: Absolute stream offset of match start
+ * \param[in]       len: Length of match in units of bytes
+ */
+typedef void (*regex_stream_fn)(void* arg, size_t start, size_t len);
+
+/**
+ * \brief           Streaming match context, matching state is carried between input chunks
+ */
+typedef struct {
+    const regex_t* r;                           /*!< Regex with compiled pattern */
+    void* mem;                                  /*!< Pointer to aligned memory for state lists */
+    size_t len;                                 /*!< Number of active instructions in current list */
+    uint8_t cur;                                /*!< Index of current list in memory */
+    size_t off;                                 /*!< Absolute stream offset of next input byte */
+    size_t* pend;                               /*!< Start and end offset pairs of matches waiting for earlier threads */
+    size_t pend_len;                            /*!< Number of pending matches */
+    regex_stream_fn fn;                         /*!< Match callback function */
+    void* arg;                                  /*!< User argument for callback function */
+} regex_stream_t;
+
+#define REGEX_PARALLEL_SPLIT_ANY                (-1)    /*!< Chunk boundary may be on any byte */
+
+/**
+ * \brief           Parallel search job function, provided by library to executor
+ * \param[in]       arg: Library argument given to executor
+ * \param[in]       job: Job index to process
+ * \param[in]       worker: Index of worker processing the job, jobs running at the same time must use different index
+ */
+typedef void (*regex_job_fn)(void* arg, size_t job, size_t worker);
+
+/**
+ * \brief           Parallel search executor function
+ *
+ * Executor must call `fn` exactly once for every job from `0` to `jobs - 1` and return when all of them are done.
+ * Jobs may run in any order and at the same time on up to `workers` threads.
+ *
+ * \param[in]       exec_arg: User argument from \ref regex_parallel_t
+ * \param[in]       jobs: Number of jobs
+ * \param[in]       workers: Number of workers with own matching context
+ * \param[in]       fn: Job function
+ * \param[in]       arg: Argument for job function
+ */
+typedef void (*regex_executor_fn)(void* exec_arg, size_t jobs, size_t workers, regex_job_fn fn, void* arg);
+
+/**
+ * \brief           Parallel search configuration, set to defaults with \ref regex_parallel_init
+ */
+typedef struct {
+    size_t workers;                             /*!< Number of workers, each has its own matching context */
+    size_t chunk_size;                          /*!< Minimal chunk size in units of bytes, chunk ends at next boundary */
+    int delim;                                  /*!< Chunk boundary byte, chunk ends after it. Set to \ref REGEX_PARALLEL_SPLIT_ANY to split at chunk size */
+    size_t chunk_matches;                       /*!< Number of matches buffered per chunk, the rest is found while merging */
+    regex_executor_fn exec;                     /*!< Executor function, set to `NULL` to use built-in one */
+    void* exec_arg;                             /*!< User argument for executor function */
+} regex_parallel_t;
+
+/**
+ * \brief           Cache of compiled patterns keyed by pattern text, see \ref regex_cache_init
+ */
+typedef struct {
+    uint8_t* mem;                               /*!< Pointer to aligned memory of slots */
+    size_t slot_size;                           /*!< Size of single slot in units of bytes */
+    size_t slots;                               /*!< Number of slots, each holds one compiled pattern */
+    uint32_t* buckets;                          /*!< Hash table with first slot of each bucket + 1, 0 if empty */
+    size_t buckets_len;                         /*!< Number of hash table buckets, power of 2 */
+    size_t p_len;                               /*!< Number of pattern entries in each slot */
+    size_t c_len;                               /*!< Number of character classes in each slot */
+    size_t text_len;                            /*!< Maximal length of pattern text in each slot */
+    uint32_t lru;                               /*!< Most recently used slot + 1, 0 if cache is empty */
+    uint32_t free;                              /*!< First free slot + 1, 0 if all slots are used */
+    size_t hits;                                /*!< Number of lookups served by already compiled pattern */
+    size_t misses;                              /*!< Number of lookups, which compiled pattern */
+    size_t evictions;                           /*!< Number of compiled patterns removed to make space for new one */
+} regex_cache_t;
+
+#if REGEX_CFG_DEBUG || __DOXYGEN__
+
+/**
+ * \brief           List of debug events reported to user callback
+ */
+typedef enum {
+    REGEX_EVT_PREPARED,                         /*!< Pattern was compiled, pattern list is available in \ref regex_t */
+    REGEX_EVT_MATCH_START,                      /*!< Matching started on new input position */
+    REGEX_EVT_PATTERN,                          /*!< Pattern entry is going to be evaluated on input position */
+    REGEX_EVT_MATCH,                            /*!< Input matched pattern */
+    REGEX_EVT_NO_MATCH,                         /*!< Input did not match pattern */
+} regex_evt_t;
+
+/**
+ * \brief           Debug callback function
+ * \param[in]       r: Regex structure with compiled pattern list
+ * \param[in]       evt: Event type
+ * \param[in]       p: Pattern entry related to event or `NULL` if not used
+ * \param[in]       str: Input position related to event or `NULL` if not used
+ */
+typedef void (*regex_debug_fn)(const regex_t* r, regex_evt_t evt, const regex_pattern_t* p, const char* str);
+
+#endif /* REGEX_CFG_DEBUG || __DOXYGEN__ */
+
 /**
  * \defgroup        RegExp Regular expression
  * \brief           Regular expression package
  * \{
  */
-uint8_t     regex_prepare(regex_t* r, const char* pattern, regex_pattern_t* p, size_t p_len);
+uint8_t     regex_prepare(regex_t* r, const char* pattern, regex_pattern_t* p, size_t p_len, regex_class_t* c, size_t c_len);
+size_t      regex_compiled_size(const char* pattern);
+size_t      regex_prepare_arena(regex_t* r, const char* pattern, void* mem, size_t mem_len);
 uint8_t     regex_match(regex_t* r, const char* str, regex_match_t* matches, size_t m_len);
+uint8_t     regex_match_n(regex_t* r, const char* str, size_t len, regex_match_t* matches, size_t m_len);
+size_t      regex_match_batch(regex_t* r, const char* const* strs, const size_t* lens, size_t n, uint8_t* results, regex_match_t* spans);
+uint8_t     regex_match_mode(regex_t* r, const char* str, size_t len, uint8_t mode, regex_match_t* span, regex_match_t* matches, size_t m_len);
+uint8_t     regex_find_next(regex_t* r, const char* str, size_t len, size_t* pos, regex_match_t* span, regex_match_t* matches, size_t m_len);
+
+size_t      regex_ctx_mem_size(const regex_t* r, size_t states);
+size_t      regex_backtrack_mem_size(const regex_t* r, size_t len);
+uint8_t     regex_ctx_init(regex_match_ctx_t* ctx, const regex_t* r, void* mem, size_t mem_len);
+uint8_t     regex_match_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, regex_match_t* matches, size_t m_len);
+uint8_t     regex_match_mode_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, uint8_t mode, regex_match_t* span, regex_match_t* matches, size_t m_len);
+uint8_t     regex_find_next_ctx(regex_match_ctx_t* ctx, const char* str, size_t len, size_t* pos, regex_match_t* span, regex_match_t* matches, size_t m_len);
+void        regex_set_budget(regex_match_ctx_t* ctx, size_t steps);
+
+uint8_t     regex_prepare_set(regex_t* r, const char* const* patterns, size_t n, regex_pattern_t* p, size_t p_len, regex_class_t* c, size_t c_len);
+size_t      regex_match_set(regex_t* r, const char* str, size_t len, uint8_t* ids);
+
+size_t      regex_export(const regex_t* r, void* buf, size_t len);
+uint8_t     regex_import(regex_t* r, const void* img, size_t img_len, regex_pattern_t* p, size_t p_len);
+
+size_t      regex_cache_mem_size(size_t slots, size_t p_len, size_t c_len, size_t text_len);
+uint8_t     regex_cache_init(regex_cache_t* cache, size_t slots, size_t p_len, size_t c_len, size_t text_len, void* mem, size_t mem_len);
+regex_t*    regex_cache_get(regex_cache_t* cache, const char* pattern);
+
+size_t      regex_stream_mem_size(const regex_t* r);
+uint8_t     regex_stream_init(regex_stream_t* st, const regex_t* r, void* mem, size_t mem_len, regex_stream_fn fn, void* arg);
+size_t      regex_stream_feed(regex_stream_t* st, const char* chunk, size_t len);
+size_t      regex_stream_finish(regex_stream_t* st);
+
+void        regex_parallel_init(regex_parallel_t* cfg);
+size_t      regex_parallel_mem_size(const regex_t* r, const regex_parallel_t* cfg, size_t len);
+uint8_t     regex_search_parallel(const regex_t* r, const regex_parallel_t* cfg, const char* str, size_t len, void* mem, size_t mem_len, regex_stream_fn fn, void* arg);
+
+size_t      regex_nfa_mem_size(const regex_t* r);
+size_t      regex_dfa_mem_size(const regex_t* r, size_t states);
+uint8_t     regex_set_engine(regex_t* r, regex_engine_t engine, void* mem, size_t mem_len);
+
+#if REGEX_CFG_STATS || __DOXYGEN__
+void        regex_stats_get(const regex_match_ctx_t* ctx, regex_stats_t* stats);
+void        regex_stats_reset(regex_match_ctx_t* ctx);
+#endif /* REGEX_CFG_STATS || __DOXYGEN__ */
+
+#if REGEX_CFG_DEBUG || __DOXYGEN__
+void        regex_debug_register(regex_debug_fn fn);
+void        regex_debug_print_pattern(const regex_t* r);
+#endif /* REGEX_CFG_DEBUG || __DOXYGEN__ */
 
 /**
  * \}
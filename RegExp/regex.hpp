@@ -0,0 +1,947 @@
+/**
+ * \file            regex.hpp
+ * \brief           Compile-time pattern compilation for C++20
+ */
+
+/*
+ * Copyright (c) 2017, Tilen MAJERLE
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the author nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \author          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#ifndef __REGEX_LIB_HPP
+#define __REGEX_LIB_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "regex.h"
+
+/*
+ * Pattern literal is parsed by constexpr copy of compile_pattern,
+ * each pattern entry is then matched by its own template instantiation
+ * of backtracking engine, so compiler can inline entire match.
+ *
+ * Syntax and results are the same as regex_match with REGEX_ENGINE_BACKTRACK engine:
+ *
+ *  if (regex::static_pattern<"/ab[0-9]{1,2}/g">::match(str, len)) { ... }
+ *  if (regex::static_pattern<"/content-length/gi">::match(str, len)) { ... }
+ *
+ * Open iterations of repeated groups are bounded by REGEX_CFG_HPP_LOOP_DEPTH,
+ * match_n reports REGEX_EXHAUSTED when limit is reached, as regex_match on full stack.
+ */
+
+namespace regex {
+
+namespace detail {
+
+constexpr uint32_t range_max = 0xFFFFFFFF;
+constexpr uint16_t grp_none = 0xFFFF;
+
+/**
+ * \brief           Pattern string usable as template argument
+ */
+template <size_t N>
+struct fixed_string {
+    char s[N] {};                               /*!< Pattern characters, including terminating zero */
+
+    constexpr fixed_string(const char (&str)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            s[i] = str[i];
+        }
+    }
+};
+
+/**
+ * \brief           Pattern entry after compile-time compilation
+ */
+struct element {
+    regex_pattern_type_t type = P_UNKNOWN;      /*!< Pattern type */
+    size_t str = 0;                             /*!< Offset of string in pattern text */
+    uint32_t len = 0;                           /*!< Length of string in pattern text, offset to group end (to group start for capture end) */
+    uint32_t alt = 0;                           /*!< Offset to next OR of the same group, valid only for capture start and OR */
+    bool poss = false;                          /*!< Set when repetitions are possessive */
+    char ch = 0;                                /*!< Character used for repetition */
+    uint32_t min = 0, max = 0;                  /*!< Minimal or maximal readings, \ref range_max for no limit */
+    uint16_t grp = 0;                           /*!< Index of capturing group, \ref grp_none for internal group */
+    regex_class_t cls {};                       /*!< Compiled class set, valid only for character classes */
+};
+
+/**
+ * \brief           Compiled pattern
+ * \note            Entries after the last one are empty, so look-ahead never leaves array
+ */
+template <size_t N>
+struct program {
+    element p[N + 3] {};                        /*!< Pattern entries */
+    size_t p_len = 0;                           /*!< Number of used entries */
+    size_t g_len = 0;                           /*!< Number of capturing groups */
+    bool valid = false;                         /*!< Set when pattern is compiled */
+};
+
+constexpr bool is_digit(char x) { return x >= '0' && x <= '9'; }
+constexpr bool is_special_meta(char x) { return x == 's' || x == 'S' || x == 'w' || x == 'W' || x == 'd' || x == 'D'; }
+constexpr bool is_special(char x) {
+    return x == '^' || x == '$' || x == '.' || x == '*' || x == '+' || x == '?' || x == '|'
+        || x == '(' || x == ')' || x == '{' || x == '}' || x == '[';
+}
+constexpr bool is_special_mod(char x) { return is_special(x) && !(x == '[' || x == '(' || x == '|' || x == ']' || x == ')' || x == '$'); }
+constexpr bool is_s(char x) { return x == ' ' || x == '\n' || x == '\r' || x == '\t' || x == '\v' || x == '\f'; }
+constexpr bool is_w(char x) { return (x >= 'a' && x <= 'z') || (x >= 'A' && x <= 'Z') || (x >= '0' && x <= '9') || x == '_'; }
+constexpr bool is_upper(char x) { return x >= 'A' && x <= 'Z'; }
+constexpr bool is_alpha(char x) { return is_upper(x) || (x >= 'a' && x <= 'z'); }
+constexpr char other_case(char x) { return is_alpha(x) ? static_cast<char>(x ^ 0x20) : x; }
+
+/**
+ * \brief           ASCII case fold table, the same as fold_table of regex.c
+ */
+struct fold_table {
+    uint8_t t[256] {};                          /*!< Lowercase letter for every byte, other bytes are not changed */
+
+    constexpr fold_table() {
+        for (size_t i = 0; i < 256; i++) {
+            t[i] = static_cast<uint8_t>(is_upper(static_cast<char>(i)) ? i + 0x20 : i);
+        }
+    }
+};
+
+inline constexpr fold_table folds {};
+
+constexpr uint8_t fold(char x) { return folds.t[static_cast<uint8_t>(x)]; }
+
+/**
+ * \brief           Match special characters for 'd', 'D', 'w', 'W', 's', 'S'
+ */
+constexpr bool
+match_special_char(char s_c, char ch) {
+    bool result = false;
+    switch (is_upper(s_c) ? s_c : static_cast<char>(s_c - 0x20)) {
+        case 'S': result = is_s(ch); break;
+        case 'W': result = is_w(ch); break;
+        case 'D': result = is_digit(ch); break;
+        default: break;
+    }
+    return is_upper(s_c) ? !result : result;
+}
+
+/**
+ * \brief           Match character against class text, the same rules as match_class_char
+ */
+constexpr bool
+match_class_char(const char* t, const element& e, char ch) {
+    const char* str = t + e.str;
+
+    for (size_t i = 0; i < e.len; i++) {
+        if (e.len - i >= 3 && str[i + 1] == '-' && ch != '-' && ch >= str[i] && ch <= str[i + 2]) {
+            return true;
+        } else if (str[i] == '\\') {
+            i++;
+            if (is_special_meta(str[i])) {
+                if (match_special_char(str[i], ch)) {
+                    return true;
+                }
+            } else if (str[i] == ch) {
+                return true;
+            }
+        } else if (ch == str[i]) {
+            return ch == '-' ? (str[0] == '-' || str[e.len - 1] == '-') : true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief           Compile character class of entry to 256-bit set
+ * \param[in]       fold: Set to add the other case of every member letter, before negation
+ */
+constexpr void
+compile_class(const char* t, element& e, bool fold) {
+    for (size_t i = 0; i < 256; i++) {
+        char ch = static_cast<char>(i), other = fold ? other_case(ch) : ch;
+        if ((match_class_char(t, e, ch) || (other != ch && match_class_char(t, e, other))) != (e.type == P_CHAR_CLASS_NOT)) {
+            e.cls.set[i >> 3] = static_cast<uint8_t>(e.cls.set[i >> 3] | (1 << (i & 0x07)));
+        }
+    }
+}
+
+/**
+ * \brief           Check pattern format, the same rules as analyze_pattern
+ * \param[out]      start: Offset of first pattern character
+ * \param[out]      length: Number of pattern characters
+ * \param[out]      fold: Set when `i` flag is used
+ */
+template <size_t N>
+constexpr bool
+analyze_pattern(const char (&t)[N], size_t& start, size_t& length, bool& fold) {
+    size_t len = 0, f;
+    int brackets = 0;
+    bool g = false;
+
+    while (len < N && t[len]) {
+        len++;
+    }
+    fold = false;
+    for (f = len; f > 0 && t[f - 1] != '/'; f--) {
+        if (t[f - 1] == 'g' && !g) {
+            g = true;
+        } else if (t[f - 1] == 'i' && !fold) {
+            fold = true;
+        } else {
+            return false;
+        }
+    }
+    if (f < 2 || t[0] != '/' || !g) {
+        return false;
+    }
+    start = 1;
+    length = f - 2;
+    for (size_t i = 1; t[i]; i++) {
+        switch (t[i]) {
+            case '\\':
+                if (t[i + 1] == '{' || t[i + 1] == '(' || t[i + 1] == '[' || t[i + 1] == '}' || t[i + 1] == ')' || t[i + 1] == ']') {
+                    i++;
+                }
+                break;
+            case '[': case '(': case '{': brackets++; break;
+            case ']': case ')': case '}': brackets--; break;
+            default: break;
+        }
+    }
+    return !brackets;
+}
+
+/**
+ * \brief           Set range of entry repetitions, the same rules as compile_quant
+ * \return          Index of entry with range plus one, `0` if there is nothing to repeat
+ */
+template <size_t N>
+constexpr size_t
+set_range(program<N>& r, size_t i, uint32_t min, uint32_t max) {
+    if (!i || r.p[i - 1].type == P_CAPTURE_START || r.p[i - 1].type == P_OR || r.p[i - 1].type == P_BEGIN || r.p[i - 1].type == P_END) {
+        return 0;
+    }
+    r.p[i - 1].min = min;
+    r.p[i - 1].max = max;
+    return i;
+}
+
+/**
+ * \brief           Link groups and alternatives with relative offsets, the same rules as compile_links
+ */
+template <size_t N>
+constexpr bool
+compile_links(program<N>& r) {
+    size_t depth = 0;
+
+    for (size_t i = 0; r.p[i].type != P_EMPTY; i++) {
+        if (r.p[i].type == P_OR && !depth) {
+            return false;
+        } else if (r.p[i].type == P_CAPTURE_END) {
+            if (!depth) {
+                return false;
+            }
+            depth--;
+        }
+        if (r.p[i].type != P_CAPTURE_START) {
+            continue;
+        }
+        if (++depth > REGEX_CFG_GROUP_DEPTH) {
+            return false;
+        }
+        size_t a = i, d = 0, q = i + 1;
+        for (; r.p[q].type != P_EMPTY; q++) {
+            if (r.p[q].type == P_CAPTURE_START) {
+                d++;
+            } else if (r.p[q].type == P_CAPTURE_END && !d--) {
+                break;
+            } else if (r.p[q].type == P_OR && !d) {
+                r.p[a].alt = static_cast<uint32_t>(q - a);
+                a = q;
+            }
+        }
+        if (r.p[q].type != P_CAPTURE_END || r.p[q].grp != r.p[i].grp) {
+            return false;
+        }
+        r.p[a].alt = 0;
+        for (a = i;; a += r.p[a].alt) {
+            r.p[a].len = static_cast<uint32_t>(q - a);
+            if (!r.p[a].alt) {
+                break;
+            }
+        }
+        r.p[q].len = static_cast<uint32_t>(q - i);
+    }
+    return true;
+}
+
+/**
+ * \brief           Parse decimal number of repetitions, the same rules as parse_count
+ * \param[in,out]   i: Offset of first digit, set to first character after number
+ * \return          `true` on success, `false` if number is not below \ref range_max
+ */
+template <size_t N>
+constexpr bool
+parse_count(const char (&t)[N], size_t& i, uint32_t& num) {
+    for (num = 0; is_digit(t[i]); i++) {
+        if (num > (range_max - 1 - static_cast<uint32_t>(t[i] - '0')) / 10) {
+            return false;
+        }
+        num = num * 10 + static_cast<uint32_t>(t[i] - '0');
+    }
+    return true;
+}
+
+/**
+ * \brief           Compile pattern text, the same steps as compile_pattern
+ */
+template <size_t N>
+constexpr program<N>
+compile_pattern(const char (&t)[N]) {
+    program<N> r {};
+    element* patterns = r.p;
+    size_t p = 0, len = 0, i = 0, quant = 0, last, nest = 0;
+    bool alt = false, fold = false;
+
+    if (!analyze_pattern(t, p, len, fold)) {
+        return r;
+    }
+    auto inc = [&]() { p++; len = len > 0 ? len - 1 : 0; };
+    while (len) {
+        bool ignore = false;
+        if (i >= N) {
+            return r;
+        }
+        patterns[i] = element {};
+        last = quant;
+        quant = 0;
+        switch (t[p]) {
+            case '^': patterns[i].type = P_BEGIN; break;
+            case '$': patterns[i].type = P_END; break;
+            case '.': patterns[i].type = P_DOT; break;
+            case '*':
+                if (!(quant = set_range(r, i, 0, range_max))) {
+                    return r;
+                }
+                ignore = true;
+                break;
+            case '+':
+                if (last) {
+                    patterns[last - 1].poss = true;
+                } else if (!(quant = set_range(r, i, 1, range_max))) {
+                    return r;
+                }
+                ignore = true;
+                break;
+            case '?':
+                if (!(quant = set_range(r, i, 0, 1))) {
+                    return r;
+                }
+                ignore = true;
+                break;
+            case '|':
+                patterns[i].type = P_OR;
+                alt = alt || !nest;
+                break;
+            case '(':
+                if (r.g_len >= grp_none) {
+                    return r;
+                }
+                nest++;
+                patterns[i].type = P_CAPTURE_START;
+                patterns[i].grp = static_cast<uint16_t>(r.g_len++);
+                break;
+            case ')': {
+                size_t depth = 0;
+                patterns[i].type = P_CAPTURE_END;
+                nest -= nest > 0;
+                for (size_t j = i; j > 0; j--) {
+                    if (patterns[j - 1].type == P_CAPTURE_END) {
+                        depth++;
+                    } else if (patterns[j - 1].type == P_CAPTURE_START && !depth--) {
+                        patterns[i].grp = patterns[j - 1].grp;
+                        break;
+                    }
+                }
+                break;
+            }
+            case '\\':
+                inc();
+                if (is_special_meta(t[p])) {
+                    patterns[i].type = P_CHAR_CLASS;
+                    patterns[i].str = p - 1;
+                    patterns[i].len = 2;
+                    compile_class(t, patterns[i], fold);
+                } else {
+                    patterns[i].type = P_CHAR;
+                    patterns[i].ch = t[p];
+                }
+                break;
+            case '[':
+                inc();
+                patterns[i].type = t[p] == '^' ? P_CHAR_CLASS_NOT : P_CHAR_CLASS;
+                if (t[p] == '^') {
+                    inc();
+                }
+                patterns[i].str = p;
+                while (t[p]) {
+                    if (t[p] == ']' && t[p - 1] != '\\') {
+                        break;
+                    }
+                    patterns[i].len++;
+                    inc();
+                }
+                compile_class(t, patterns[i], fold);
+                break;
+            case '{': {
+                size_t tmp = p + 1;
+                uint8_t type = 0;
+                uint32_t num1 = 0, num2 = 0;
+                if (is_digit(t[tmp])) {
+                    if (!parse_count(t, tmp, num1)) {
+                        return r;
+                    }
+                    if (t[tmp] == ',') {
+                        tmp++;
+                        type = 2;
+                        if (is_digit(t[tmp])) {
+                            type = 3;
+                            if (!parse_count(t, tmp, num2)) {
+                                return r;
+                            }
+                            if (num1 > num2) {
+                                type = 0;
+                            }
+                        }
+                    } else {
+                        type = 1;
+                    }
+                    if (t[tmp++] != '}') {
+                        type = 0;
+                    }
+                }
+                if (type) {
+                    if (!(quant = set_range(r, i, num1, type == 2 ? range_max : (type == 1 ? num1 : num2)))) {
+                        return r;
+                    }
+                    while (p != tmp) {
+                        inc();
+                    }
+                    continue;
+                }
+            }
+                [[fallthrough]];
+            default:
+                if (len > 1 && !is_special(t[p + 1])) {
+                    patterns[i].type = P_CHAR_SEQUENCE;
+                    patterns[i].str = p;
+                    patterns[i].len = 1;
+                    while ((len - 1) && t[p]) {
+                        if (t[p + 1] == '\\') {
+                            if (is_special_meta(t[p + 2])) {
+                                break;
+                            }
+                        } else if (is_special_mod(t[p + 2])) {
+                            break;
+                        } else if (t[p] != '\\' && is_special(t[p + 1])) {
+                            break;
+                        }
+                        patterns[i].len++;
+                        inc();
+                    }
+                } else {
+                    patterns[i].type = P_CHAR;
+                    patterns[i].ch = t[p];
+                }
+                break;
+        }
+        if (fold && patterns[i].type == P_CHAR && is_alpha(patterns[i].ch)) {   /* Letter matches both cases */
+            patterns[i].type = P_CHAR_CLASS;
+            patterns[i].str = p;
+            patterns[i].len = 1;
+            compile_class(t, patterns[i], fold);
+        } else if (fold && patterns[i].type == P_CHAR_SEQUENCE) {
+            for (size_t j = 0; j < patterns[i].len; j++) {
+                if (is_alpha(t[patterns[i].str + j])) {
+                    patterns[i].type = P_CHAR_SEQUENCE_FOLD;
+                }
+            }
+        }
+        if (!ignore) {
+            i++;
+        }
+        inc();
+    }
+    if (alt) {                                  /* Alternation outside of groups is enclosed in internal group */
+        size_t b = i > 0 && patterns[0].type == P_BEGIN, e = i > b && patterns[i - 1].type == P_END ? i - 1 : i;
+        for (size_t j = i + 2; j > e + 2; j--) {
+            patterns[j - 1] = patterns[j - 3];
+        }
+        for (size_t j = e + 1; j > b + 1; j--) {
+            patterns[j - 1] = patterns[j - 2];
+        }
+        patterns[b] = element {};
+        patterns[e + 1] = element {};
+        patterns[b].type = P_CAPTURE_START;
+        patterns[e + 1].type = P_CAPTURE_END;
+        patterns[b].grp = patterns[e + 1].grp = grp_none;
+        i += 2;
+    }
+    if (i >= N + 3) {
+        return r;
+    }
+    for (size_t j = i; j < N + 3; j++) {
+        r.p[j].type = P_EMPTY;
+    }
+    for (size_t j = 0; j < i; j++) {            /* Repetition {1} is removed, the same as by optimizer */
+        if (r.p[j].min == 1 && r.p[j].max == 1) {
+            r.p[j].min = r.p[j].max = 0;
+            r.p[j].poss = false;
+        }
+    }
+    r.p_len = i + 1;
+    r.valid = compile_links(r);
+    return r;
+}
+
+} /* namespace detail */
+
+/**
+ * \brief           Pattern compiled at compile time
+ * \tparam          P: Pattern literal in the same format as for \ref regex_prepare, such as `"/ab[0-9]{1,2}/g"`
+ */
+template <detail::fixed_string P>
+class static_pattern {
+  private:
+    static constexpr auto prog = detail::compile_pattern(P.s);
+    static_assert(prog.valid, "Invalid regular expression pattern");
+
+    /**
+     * \brief           Matching state, equivalent of \ref regex_match_ctx_t
+     */
+    struct ctx {
+        const char* end;                        /*!< Pointer to first byte after input string */
+        const char* m_end;                      /*!< Pointer to end of match */
+        regex_match_t* matches;                 /*!< Pointer to array of matches */
+        size_t m_totlen;                        /*!< Total length of matches array */
+        size_t depth = 0;                       /*!< Number of open iterations of repeated groups */
+        bool exhausted = false;                 /*!< Set when \ref REGEX_CFG_HPP_LOOP_DEPTH was reached, match result is not valid */
+    };
+
+    /**
+     * \brief           Iteration of repeated group, equivalent of iteration frame of backtracking stack
+     */
+    struct loop {
+        loop* up;                               /*!< Iteration of enclosing repeated group, `nullptr` if none */
+        const char* s;                          /*!< Input position at iteration start */
+        size_t cnt;                             /*!< Number of iterations before this one */
+        bool atomic;                            /*!< Set when iteration returns at group end, used by possessive group */
+        const char* end;                        /*!< Input position at group end of atomic iteration */
+    };
+
+    static constexpr const detail::element& at(size_t i) { return prog.p[i]; }
+
+    static constexpr bool
+    can_match_more(size_t i) {
+        return !(at(i + 1).type == P_EMPTY
+                 || (at(i + 1).type == P_CAPTURE_END && !at(i + 1).min && !at(i + 1).max && at(i + 2).type == P_EMPTY));
+    }
+
+    static constexpr bool
+    captured(const ctx& c, size_t i) {
+        return at(i).grp != detail::grp_none && at(i).grp < c.m_totlen;
+    }
+
+    /**
+     * \brief           Check if entry `i` is inside iteration of possessive group, where repetitions are greedy
+     */
+    static constexpr bool
+    in_possessive(size_t i) {
+        for (size_t j = 0; j < i; j++) {
+            if (at(j).type == P_CAPTURE_START && i < j + at(j).len && at(j + at(j).len).poss) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <size_t I>
+    static bool
+    match_one_char(const char* s) noexcept {
+        constexpr const detail::element& e = at(I);
+        if constexpr (e.type == P_DOT) {
+            return true;
+        } else if constexpr (e.type == P_CHAR_CLASS || e.type == P_CHAR_CLASS_NOT) {
+            return (e.cls.set[static_cast<uint8_t>(*s) >> 3] & (1 << (static_cast<uint8_t>(*s) & 0x07))) != 0;
+        } else {
+            return *s == e.ch;
+        }
+    }
+
+    template <size_t I, bool Cont>
+    static bool
+    match_char_sequence(ctx& c, const char* str, loop* l) noexcept {
+        constexpr const detail::element& e = at(I);
+        const char* s = str;
+        size_t i;
+
+        for (i = 0; i < e.len; i++) {
+            if (s >= c.end) {
+                break;
+            }
+            if (P.s[e.str + i] == '\\') {
+                i++;
+            }
+            if (*s != P.s[e.str + i] && (e.type != P_CHAR_SEQUENCE_FOLD || detail::fold(*s) != detail::fold(P.s[e.str + i]))) {
+                break;
+            }
+            s++;
+        }
+        if (i == e.len) {
+            if constexpr (Cont) {
+                return match_pattern<I + 1>(c, s, l);
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <size_t I>
+    static bool
+    match_pattern_range(ctx& c, const char* str, loop* l) noexcept {
+        constexpr const detail::element& e = at(I);
+        constexpr bool greedy = !e.poss && can_match_more(I) && in_possessive(I);
+        size_t cnt = 0;
+        const char* s = str;
+
+        if constexpr (!e.min && !e.poss && !greedy && can_match_more(I)) {
+            if (match_pattern<I + 1>(c, s, l)) {
+                return true;
+            }
+        }
+        while ((e.max == detail::range_max || cnt < e.max) && s < c.end) {
+            if constexpr (e.type == P_CHAR_SEQUENCE || e.type == P_CHAR_SEQUENCE_FOLD) {
+                if (!match_char_sequence<I, false>(c, s, l)) {
+                    break;
+                }
+                s += e.len;
+            } else {
+                if (!match_one_char<I>(s)) {
+                    break;
+                }
+                s++;
+            }
+            cnt++;
+            if constexpr (!e.poss && !greedy && can_match_more(I)) {
+                if (cnt >= e.min && match_pattern<I + 1>(c, s, l)) {
+                    return true;
+                }
+            }
+        }
+        if constexpr (greedy) {                 /* Give back one repetition at a time until rest of pattern matches */
+            for (; cnt >= e.min; cnt--, s -= e.type == P_CHAR_SEQUENCE || e.type == P_CHAR_SEQUENCE_FOLD ? e.len : 1) {
+                if (match_pattern<I + 1>(c, s, l)) {
+                    return true;
+                }
+                if (cnt == 0) {
+                    break;
+                }
+            }
+            return false;
+        } else if (cnt >= e.min && (e.max == detail::range_max || cnt <= e.max)) {
+            if constexpr (!e.poss && can_match_more(I)) {   /* Rest of pattern already failed after every repetition */
+                return false;
+            } else if constexpr (can_match_more(I)) {
+                return match_pattern<I + 1>(c, s, l);
+            } else {
+                if constexpr (at(I + 1).type == P_CAPTURE_END) {
+                    if (captured(c, I + 1)) {
+                        c.matches[at(I + 1).grp].len = static_cast<size_t>(s - c.matches[at(I + 1).grp].s);
+                    }
+                }
+                c.m_end = s;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * \brief           Try alternatives of group from alternative at group start or OR `A`
+     */
+    template <size_t A>
+    static bool
+    match_alts(ctx& c, const char* s, loop* l) noexcept {
+        if (match_pattern<A + 1>(c, s, l)) {
+            return true;
+        }
+        if constexpr (at(A).alt != 0) {
+            return match_alts<A + at(A).alt>(c, s, l);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * \brief           Match group `G` once, capturing group is restored when all alternatives fail
+     */
+    template <size_t G>
+    static bool
+    match_group(ctx& c, const char* s, loop* l) noexcept {
+        regex_match_t old {};
+
+        if (captured(c, G)) {
+            old = c.matches[at(G).grp];
+            c.matches[at(G).grp].s = s;
+            c.matches[at(G).grp].len = 0;
+        }
+        if (match_alts<G>(c, s, l)) {
+            return true;
+        }
+        if (captured(c, G)) {
+            c.matches[at(G).grp] = old;
+        }
+        return false;
+    }
+
+    /**
+     * \brief           Decide between next iteration of repeated group `G` and rest of pattern
+     * \param[in]       cnt: Number of iterations done
+     * \param[in]       up: Iteration of enclosing repeated group
+     */
+    template <size_t G>
+    static bool
+    match_loop(ctx& c, const char* s, size_t cnt, loop* up) noexcept {
+        bool res;
+
+        if (c.exhausted || c.depth == REGEX_CFG_HPP_LOOP_DEPTH) {  /* Each iteration is one level of native recursion */
+            c.exhausted = true;
+            return false;
+        }
+        c.depth++;
+        res = match_loop_next<G>(c, s, cnt, up);
+        c.depth--;
+        return res;
+    }
+
+    /**
+     * \brief           Match next iteration of repeated group `G` or rest of pattern, called by \ref match_loop
+     */
+    template <size_t G>
+    static bool
+    match_loop_next(ctx& c, const char* s, size_t cnt, loop* up) noexcept {
+        constexpr size_t E = G + at(G).len;
+        loop l {up, s, cnt, false, nullptr};
+
+        if (!(at(E).max == detail::range_max || cnt < at(E).max)) {
+            return match_pattern<E + 1>(c, s, up);
+        }
+        if (cnt >= at(E).min) {
+            if constexpr (!can_match_more(E) || in_possessive(G)) {    /* Greedy, exit only when next iteration fails */
+                return match_group<G>(c, s, &l) || match_pattern<E + 1>(c, s, up);
+            } else if (match_pattern<E + 1>(c, s, up)) {    /* Lazy, next iteration only when rest of pattern fails */
+                return true;
+            }
+        }
+        return match_group<G>(c, s, &l);
+    }
+
+    /**
+     * \brief           Get first capturing group of group at `g` and groups nested in it
+     */
+    static constexpr size_t
+    groups_first(size_t g) {
+        for (size_t i = g; i <= g + at(g).len; i++) {
+            if (at(i).type == P_CAPTURE_START && at(i).grp != detail::grp_none) {
+                return at(i).grp;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * \brief           Get number of capturing groups of group at `g` and groups nested in it
+     */
+    static constexpr size_t
+    groups_count(size_t g) {
+        size_t n = 0;
+        for (size_t i = g; i <= g + at(g).len; i++) {
+            n += at(i).type == P_CAPTURE_START && at(i).grp != detail::grp_none;
+        }
+        return n;
+    }
+
+    /**
+     * \brief           Match possessive repeated group `G`, iterations are never given back
+     *
+     * Committed iterations do not restore their groups when they return,
+     * so all groups of repeated group are restored when rest of pattern fails.
+     */
+    template <size_t G>
+    static bool
+    match_loop_possessive(ctx& c, const char* s, loop* up) noexcept {
+        constexpr size_t E = G + at(G).len, F = groups_first(G), N = groups_count(G);
+        regex_match_t old[N > 0 ? N : 1];
+        size_t cnt = 0;
+
+        for (size_t i = 0; i < N && F + i < c.m_totlen; i++) {
+            old[i] = c.matches[F + i];
+        }
+        while (at(E).max == detail::range_max || cnt < at(E).max) {
+            loop l {up, s, cnt, true, nullptr};
+            if (!match_group<G>(c, s, &l)) {
+                break;
+            }
+            cnt++;
+            if (l.end == s) {                   /* Empty iteration ends repetitions */
+                break;
+            }
+            s = l.end;
+        }
+        if (cnt >= at(E).min && match_pattern<E + 1>(c, s, up)) {
+            return true;
+        }
+        for (size_t i = 0; i < N && F + i < c.m_totlen; i++) {
+            c.matches[F + i] = old[i];
+        }
+        return false;
+    }
+
+    template <size_t I>
+    static bool
+    match_pattern(ctx& c, const char* s, loop* l) noexcept {
+        constexpr const detail::element& e = at(I);
+        if constexpr (e.type == P_OR) {         /* Alternative matched, continue after group */
+            return match_pattern<I + e.len>(c, s, l);
+        } else if constexpr (e.type == P_CAPTURE_START) {
+            if constexpr (at(I + e.len).poss) {
+                return match_loop_possessive<I>(c, s, l);
+            } else if constexpr (at(I + e.len).min || at(I + e.len).max) {
+                return match_loop<I>(c, s, 0, l);
+            } else {
+                return match_group<I>(c, s, l);
+            }
+        } else if constexpr (e.type == P_CAPTURE_END) {
+            if (captured(c, I)) {
+                c.matches[e.grp].len = static_cast<size_t>(s - c.matches[e.grp].s);
+            }
+            if constexpr (e.min || e.max) {     /* Iteration of repeated group is finished */
+                if (l->atomic) {
+                    l->end = s;
+                    return true;
+                } else if (s == l->s) {         /* Empty iteration ends repetitions */
+                    return match_pattern<I + 1>(c, s, l->up);
+                }
+                return match_loop<I - e.len>(c, s, l->cnt + 1, l->up);
+            } else {
+                return match_pattern<I + 1>(c, s, l);
+            }
+        } else if constexpr (e.type == P_EMPTY) {
+            c.m_end = s;
+            return true;
+        } else if constexpr (at(I + 1).type == P_QM) {
+            c.m_end = s;
+            return true;
+        } else if constexpr (e.min || e.max) {
+            return match_pattern_range<I>(c, s, l);
+        } else if constexpr (e.type == P_CHAR_SEQUENCE || e.type == P_CHAR_SEQUENCE_FOLD) {
+            return match_char_sequence<I, true>(c, s, l);
+        } else if constexpr (e.type == P_END && at(I + 1).type == P_EMPTY) {
+            c.m_end = s;
+            return s == c.end;
+        } else if constexpr (e.type == P_END) {    /* End anywhere in pattern, rest may only match empty string */
+            return s == c.end && match_pattern<I + 1>(c, s, l);
+        } else {
+            if (s < c.end && match_one_char<I>(s)) {
+                return match_pattern<I + 1>(c, s + 1, l);
+            }
+            return false;
+        }
+    }
+
+    static void
+    reset_matches(ctx& c) noexcept {
+        for (size_t i = 0; i < c.m_totlen; i++) {
+            c.matches[i].s = nullptr;
+            c.matches[i].len = 0;
+        }
+    }
+
+  public:
+    static constexpr size_t groups = prog.g_len;    /*!< Number of capturing groups in pattern */
+
+    /**
+     * \brief           Check if input buffer and pattern matches, with result values of \ref regex_match_n
+     * \param[in]       str: Pointer to input buffer to make match on
+     * \param[in]       len: Length of input buffer in units of bytes
+     * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `nullptr` if not used
+     * \param[in]       m_len: Number of entries in matches array, first `min(groups, m_len)` entries are valid after match
+     * \return          `1` on match, `0` otherwise, \ref REGEX_EXHAUSTED when match needs more
+     *                      than \ref REGEX_CFG_HPP_LOOP_DEPTH open iterations of repeated groups
+     */
+    static uint8_t
+    match_n(const char* str, size_t len, regex_match_t* matches = nullptr, size_t m_len = 0) noexcept {
+        constexpr bool anc = at(0).type == P_BEGIN;
+        ctx c {str + len, str, matches, matches != nullptr ? m_len : 0};
+
+        reset_matches(c);
+        do {
+            if (match_pattern<anc ? 1 : 0>(c, str, nullptr) && !c.exhausted) {
+                return 1;
+            }
+        } while (!c.exhausted && !anc && str++ != c.end);
+        reset_matches(c);
+        return c.exhausted ? REGEX_EXHAUSTED : 0;
+    }
+
+    /**
+     * \brief           Check if input buffer and pattern matches
+     * \param[in]       str: Pointer to input buffer to make match on
+     * \param[in]       len: Length of input buffer in units of bytes
+     * \param[out]      matches: Array to write capturing groups to, in order of opening bracket. Set to `nullptr` if not used
+     * \param[in]       m_len: Number of entries in matches array, first `min(groups, m_len)` entries are valid after match
+     * \return          `true` on match, `false` otherwise, also when \ref match_n returns \ref REGEX_EXHAUSTED
+     */
+    static bool
+    match(const char* str, size_t len, regex_match_t* matches = nullptr, size_t m_len = 0) noexcept {
+        return match_n(str, len, matches, m_len) == 1;
+    }
+
+    /**
+     * \brief           Check if NULL-terminated string and pattern matches
+     * \param[in]       str: Pointer to NULL-terminated input string
+     * \param[out]      matches: Array to write capturing groups to. Set to `nullptr` if not used
+     * \param[in]       m_len: Number of entries in matches array
+     * \return          `true` on match, `false` otherwise
+     */
+    static bool
+    match(const char* str, regex_match_t* matches = nullptr, size_t m_len = 0) noexcept {
+        return match(str, std::strlen(str), matches, m_len);
+    }
+};
+
+} /* namespace regex */
+
+#endif /* __REGEX_LIB_HPP */
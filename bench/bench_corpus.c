@@ -0,0 +1,172 @@
+/**
+ * \file            bench_corpus.c
+ * \brief           Generated input corpora for benchmark and regression harness
+ */
+
+/*
+ * Copyright (c) 2017, Tilen MAJERLE
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the author nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \author          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench_corpus.h"
+
+/*
+ * Corpora are generated from fixed seed, so every run and every build
+ * matches the same bytes and results can be compared between changes.
+ */
+
+#define LINE_MAX_LEN                            256
+
+static const char* names[] = {"log", "http", "csv", "redos"};
+static const char* levels[] = {"INFO ", "WARN ", "ERROR", "DEBUG"};
+static const char* methods[] = {"GET", "POST", "PUT", "DELETE"};
+static const char* resources[] = {"items", "users", "orders", "carts", "reports"};
+static const char* users[] = {"alice", "bob", "carol", "dave", "erin", "mallory", "trent"};
+static const char* domains[] = {"example", "mail", "corp", "shop"};
+static const char* states[] = {"PAID", "OPEN", "VOID", "PAID"};
+static const int codes[] = {200, 200, 201, 204, 301, 404, 500};
+
+#define PICK(arr)                               arr[rnd(&seed) % (sizeof(arr) / sizeof(arr[0]))]
+
+/**
+ * \brief           Get next pseudo-random number
+ * \param[in,out]   seed: Generator state
+ * \return          Random number
+ */
+static uint32_t
+rnd(uint32_t* seed) {
+    *seed = *seed * 1103515245UL + 12345UL;
+    return (*seed >> 8) & 0x00FFFFFF;
+}
+
+/**
+ * \brief           Write single line of given corpus kind
+ * \param[in]       kind: Corpus kind
+ * \param[in,out]   seed_p: Generator state
+ * \param[out]      line: Output buffer of \ref LINE_MAX_LEN bytes
+ * \return          Length of line, without newline
+ */
+static size_t
+gen_line(bench_corpus_kind_t kind, uint32_t* seed_p, char* line) {
+    uint32_t seed = *seed_p;
+    int len = 0;
+    size_t i, n;
+
+    switch (kind) {
+        case BENCH_CORPUS_LOG:
+            len = snprintf(line, LINE_MAX_LEN, "2026-%02u-%02u %02u:%02u:%02u.%03u %s [worker-%u] %s /api/v%u/%s/%u %d %ums user=%s@%s.com",
+                           (unsigned)(1 + rnd(&seed) % 12), (unsigned)(1 + rnd(&seed) % 28), (unsigned)(rnd(&seed) % 24),
+                           (unsigned)(rnd(&seed) % 60), (unsigned)(rnd(&seed) % 60), (unsigned)(rnd(&seed) % 1000),
+                           PICK(levels), (unsigned)(rnd(&seed) % 16), PICK(methods), (unsigned)(1 + rnd(&seed) % 3),
+                           PICK(resources), (unsigned)(rnd(&seed) % 100000), PICK(codes), (unsigned)(rnd(&seed) % 5000),
+                           PICK(users), PICK(domains));
+            break;
+        case BENCH_CORPUS_HTTP:
+            switch (rnd(&seed) % 9) {
+                case 0: len = snprintf(line, LINE_MAX_LEN, "%s /%s/%u HTTP/1.1", PICK(methods), PICK(resources), (unsigned)(rnd(&seed) % 1000)); break;
+                case 1: len = snprintf(line, LINE_MAX_LEN, "Host: www.%s.com", PICK(domains)); break;
+                case 2: len = snprintf(line, LINE_MAX_LEN, "Content-Length: %u", (unsigned)(rnd(&seed) % 100000)); break;
+                case 3: len = snprintf(line, LINE_MAX_LEN, "content-length: %u", (unsigned)(rnd(&seed) % 100000)); break;
+                case 4: len = snprintf(line, LINE_MAX_LEN, "Content-Type: application/json; charset=utf-8"); break;
+                case 5: len = snprintf(line, LINE_MAX_LEN, "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/%u.0", (unsigned)(90 + rnd(&seed) % 40)); break;
+                case 6: len = snprintf(line, LINE_MAX_LEN, "Accept-Encoding: gzip, deflate, br"); break;
+                case 7: len = snprintf(line, LINE_MAX_LEN, "Cookie: sid=%06x; theme=dark; lang=en", (unsigned)rnd(&seed)); break;
+                default: len = snprintf(line, LINE_MAX_LEN, "X-Request-Id: %06x-%04x", (unsigned)rnd(&seed), (unsigned)(rnd(&seed) & 0xFFFF)); break;
+            }
+            break;
+        case BENCH_CORPUS_CSV:
+            len = snprintf(line, LINE_MAX_LEN, "%u,%s,%s@%s.com,2026-%02u-%02u,%u.%02u,%s",
+                           (unsigned)(rnd(&seed) % 100000), PICK(users), PICK(users), PICK(domains),
+                           (unsigned)(1 + rnd(&seed) % 12), (unsigned)(1 + rnd(&seed) % 28),
+                           (unsigned)(rnd(&seed) % 500), (unsigned)(rnd(&seed) % 100), PICK(states));
+            break;
+        case BENCH_CORPUS_REDOS:
+            n = 12 + rnd(&seed) % 12;           /* Long run without expected end character */
+            for (i = 0; i < n; i++) {
+                line[i] = rnd(&seed) % 8 ? 'a' : '1';
+            }
+            line[n] = "!?x"[rnd(&seed) % 3];
+            len = (int)n + 1;
+            break;
+        default:
+            break;
+    }
+    *seed_p = seed;
+    return len > 0 ? (size_t)len : 0;
+}
+
+/**
+ * \brief           Generate corpus of given kind
+ * \param[out]      c: Corpus to initialize, release with \ref bench_corpus_free
+ * \param[in]       kind: Corpus kind
+ * \param[in]       size: Approximate size of corpus in units of bytes
+ * \return          1 on success, 0 otherwise
+ */
+uint8_t
+bench_corpus_init(bench_corpus_t* c, bench_corpus_kind_t kind, size_t size) {
+    char line[LINE_MAX_LEN];
+    uint32_t seed = 0x1234U + (uint32_t)kind;
+    size_t len, cap_lines = size / 8 + 1;
+
+    memset(c, 0x00, sizeof(*c));
+    c->name = names[kind];
+    c->buf = malloc(size + LINE_MAX_LEN + 1);
+    c->off = malloc(cap_lines * sizeof(*c->off));
+    c->line_len = malloc(cap_lines * sizeof(*c->line_len));
+    if (c->buf == NULL || c->off == NULL || c->line_len == NULL) {
+        bench_corpus_free(c);
+        return 0;
+    }
+    while (c->len < size && c->lines < cap_lines) {
+        len = gen_line(kind, &seed, line);
+        c->off[c->lines] = c->len;
+        c->line_len[c->lines] = len;
+        memcpy(&c->buf[c->len], line, len);
+        c->len += len;
+        c->buf[c->len++] = '\n';
+        c->lines++;
+        if (len > c->max_line) {
+            c->max_line = len;
+        }
+    }
+    c->buf[c->len] = '\0';
+    return 1;
+}
+
+/**
+ * \brief           Release memory of corpus
+ * \param[in]       c: Corpus to release
+ */
+void
+bench_corpus_free(bench_corpus_t* c) {
+    free(c->buf);
+    free(c->off);
+    free(c->line_len);
+    memset(c, 0x00, sizeof(*c));
+}
@@ -0,0 +1,75 @@
+/**
+ * \file            bench_corpus.h
+ * \brief           Generated input corpora for benchmark and regression harness
+ */
+
+/*
+ * Copyright (c) 2017, Tilen MAJERLE
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the author nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \author          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#ifndef __BENCH_CORPUS_H
+#define __BENCH_CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief           Kind of generated corpus
+ */
+typedef enum {
+    BENCH_CORPUS_LOG,                           /*!< Application log lines with timestamps, levels and requests */
+    BENCH_CORPUS_HTTP,                          /*!< HTTP request lines and headers */
+    BENCH_CORPUS_CSV,                           /*!< CSV records with numbers, e-mails and dates */
+    BENCH_CORPUS_REDOS,                         /*!< Repeated characters without expected end, pathological for backtracking */
+    BENCH_CORPUS_CNT,                           /*!< Number of corpus kinds */
+} bench_corpus_kind_t;
+
+/**
+ * \brief           Generated corpus, lines are separated by `\n`
+ */
+typedef struct {
+    const char* name;                           /*!< Name of corpus kind */
+    char* buf;                                  /*!< Buffer with all lines */
+    size_t len;                                 /*!< Length of buffer in units of bytes */
+    size_t* off;                                /*!< Offset of each line in buffer */
+    size_t* line_len;                           /*!< Length of each line, without newline */
+    size_t lines;                               /*!< Number of lines */
+    size_t max_line;                            /*!< Length of longest line */
+} bench_corpus_t;
+
+uint8_t     bench_corpus_init(bench_corpus_t* c, bench_corpus_kind_t kind, size_t size);
+void        bench_corpus_free(bench_corpus_t* c);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __BENCH_CORPUS_H */
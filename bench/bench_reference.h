@@ -0,0 +1,1666 @@
+/* Generated by gen_reference.py, do not edit */
+{"/\\d+/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 0, 4},
+{"/\\d+/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 0, 4},
+{"/\\d+/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 0, 4},
+{"/\\d+/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 0, 4},
+{"/\\d+/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 0, 4},
+{"/\\d+/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 0, 4},
+{"/\\d+/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 14, 3},
+{"/\\d+/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/\\d+/g", "Content-Length: 38584", 21, 1, 16, 5},
+{"/\\d+/g", "content-length: 35263", 21, 1, 16, 5},
+{"/\\d+/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 20, 1},
+{"/\\d+/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 12, 2},
+{"/\\d+/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 14, 1},
+{"/\\d+/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 0, 5},
+{"/\\d+/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 0, 5},
+{"/\\d+/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 0, 5},
+{"/\\d+/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 0, 5},
+{"/\\d+/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 0, 5},
+{"/\\d+/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 0, 5},
+{"/\\d+/g", "aa1aaaaaaaaa\?", 13, 1, 2, 1},
+{"/\\d+/g", "aaaaaa1aaa1x", 12, 1, 6, 1},
+{"/\\d+/g", "a11aaaaaaaaaaaax", 16, 1, 1, 2},
+{"/\\d+/g", "aaa1aa11aaa1a\?", 14, 1, 3, 1},
+{"/\\d+/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\d+/g", "aaaaaaaaaa1ab", 13, 1, 10, 1},
+{"/\\d+/g", "", 0, 0, 0, 0},
+{"/\\d+/g", "a", 1, 0, 0, 0},
+{"/\\d+/g", "ab", 2, 0, 0, 0},
+{"/\\d+/g", "abc", 3, 0, 0, 0},
+{"/\\d+/g", "aab", 3, 0, 0, 0},
+{"/\\d+/g", "abcd", 4, 0, 0, 0},
+{"/\\d+/g", "aaab", 4, 0, 0, 0},
+{"/\\d+/g", "AAB", 3, 0, 0, 0},
+{"/\\d+/g", "xyz", 3, 0, 0, 0},
+{"/\\d+/g", "xz", 2, 0, 0, 0},
+{"/\\d+/g", "zzy", 3, 0, 0, 0},
+{"/\\d+/g", "ab ab", 5, 0, 0, 0},
+{"/\\d+/g", "acbcd", 5, 0, 0, 0},
+{"/\\d+/g", "ababc", 5, 0, 0, 0},
+{"/\\d+/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\d+/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\d+/g", "b1a ba1", 7, 1, 1, 1},
+{"/\\d+/g", "12:34:56", 8, 1, 0, 2},
+{"/\\d+/g", "#$%", 3, 0, 0, 0},
+{"/\\d+/g", " \011word", 6, 0, 0, 0},
+{"/[A-Z]+/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 24, 4},
+{"/[A-Z]+/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 24, 4},
+{"/[A-Z]+/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 24, 4},
+{"/[A-Z]+/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 24, 5},
+{"/[A-Z]+/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 24, 5},
+{"/[A-Z]+/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 24, 4},
+{"/[A-Z]+/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 0, 6},
+{"/[A-Z]+/g", "Host: www.mail.com", 18, 1, 0, 1},
+{"/[A-Z]+/g", "Content-Length: 38584", 21, 1, 0, 1},
+{"/[A-Z]+/g", "content-length: 35263", 21, 0, 0, 0},
+{"/[A-Z]+/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 0, 1},
+{"/[A-Z]+/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 0, 1},
+{"/[A-Z]+/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 0, 1},
+{"/[A-Z]+/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 44, 4},
+{"/[A-Z]+/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 47, 4},
+{"/[A-Z]+/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 47, 4},
+{"/[A-Z]+/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 46, 4},
+{"/[A-Z]+/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 45, 4},
+{"/[A-Z]+/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 44, 4},
+{"/[A-Z]+/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/[A-Z]+/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/[A-Z]+/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/[A-Z]+/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/[A-Z]+/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/[A-Z]+/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/[A-Z]+/g", "", 0, 0, 0, 0},
+{"/[A-Z]+/g", "a", 1, 0, 0, 0},
+{"/[A-Z]+/g", "ab", 2, 0, 0, 0},
+{"/[A-Z]+/g", "abc", 3, 0, 0, 0},
+{"/[A-Z]+/g", "aab", 3, 0, 0, 0},
+{"/[A-Z]+/g", "abcd", 4, 0, 0, 0},
+{"/[A-Z]+/g", "aaab", 4, 0, 0, 0},
+{"/[A-Z]+/g", "AAB", 3, 1, 0, 3},
+{"/[A-Z]+/g", "xyz", 3, 0, 0, 0},
+{"/[A-Z]+/g", "xz", 2, 0, 0, 0},
+{"/[A-Z]+/g", "zzy", 3, 0, 0, 0},
+{"/[A-Z]+/g", "ab ab", 5, 0, 0, 0},
+{"/[A-Z]+/g", "acbcd", 5, 0, 0, 0},
+{"/[A-Z]+/g", "ababc", 5, 0, 0, 0},
+{"/[A-Z]+/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/[A-Z]+/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/[A-Z]+/g", "b1a ba1", 7, 0, 0, 0},
+{"/[A-Z]+/g", "12:34:56", 8, 0, 0, 0},
+{"/[A-Z]+/g", "#$%", 3, 0, 0, 0},
+{"/[A-Z]+/g", " \011word", 6, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/ERROR|WARN/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/ERROR|WARN/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/ERROR|WARN/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/ERROR|WARN/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/ERROR|WARN/g", "content-length: 35263", 21, 0, 0, 0},
+{"/ERROR|WARN/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/ERROR|WARN/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/ERROR|WARN/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/ERROR|WARN/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/ERROR|WARN/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/ERROR|WARN/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/ERROR|WARN/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/ERROR|WARN/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/ERROR|WARN/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/ERROR|WARN/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/ERROR|WARN/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/ERROR|WARN/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/ERROR|WARN/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/ERROR|WARN/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/ERROR|WARN/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/ERROR|WARN/g", "", 0, 0, 0, 0},
+{"/ERROR|WARN/g", "a", 1, 0, 0, 0},
+{"/ERROR|WARN/g", "ab", 2, 0, 0, 0},
+{"/ERROR|WARN/g", "abc", 3, 0, 0, 0},
+{"/ERROR|WARN/g", "aab", 3, 0, 0, 0},
+{"/ERROR|WARN/g", "abcd", 4, 0, 0, 0},
+{"/ERROR|WARN/g", "aaab", 4, 0, 0, 0},
+{"/ERROR|WARN/g", "AAB", 3, 0, 0, 0},
+{"/ERROR|WARN/g", "xyz", 3, 0, 0, 0},
+{"/ERROR|WARN/g", "xz", 2, 0, 0, 0},
+{"/ERROR|WARN/g", "zzy", 3, 0, 0, 0},
+{"/ERROR|WARN/g", "ab ab", 5, 0, 0, 0},
+{"/ERROR|WARN/g", "acbcd", 5, 0, 0, 0},
+{"/ERROR|WARN/g", "ababc", 5, 0, 0, 0},
+{"/ERROR|WARN/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/ERROR|WARN/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/ERROR|WARN/g", "b1a ba1", 7, 0, 0, 0},
+{"/ERROR|WARN/g", "12:34:56", 8, 0, 0, 0},
+{"/ERROR|WARN/g", "#$%", 3, 0, 0, 0},
+{"/ERROR|WARN/g", " \011word", 6, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 30, 10},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 30, 11},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 30, 11},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 30, 10},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 30, 10},
+{"/\\[worker-\\d{1,2}\\]/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 30, 11},
+{"/\\[worker-\\d{1,2}\\]/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "content-length: 35263", 21, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "", 0, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "a", 1, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "ab", 2, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "abc", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aab", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "abcd", 4, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaab", 4, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "AAB", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "xyz", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "xz", 2, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "zzy", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "ab ab", 5, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "acbcd", 5, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "ababc", 5, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "b1a ba1", 7, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "12:34:56", 8, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", "#$%", 3, 0, 0, 0},
+{"/\\[worker-\\d{1,2}\\]/g", " \011word", 6, 0, 0, 0},
+{"/user=.*\\.com/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 81, 18},
+{"/user=.*\\.com/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 77, 18},
+{"/user=.*\\.com/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 79, 17},
+{"/user=.*\\.com/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 81, 18},
+{"/user=.*\\.com/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 76, 21},
+{"/user=.*\\.com/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 82, 21},
+{"/user=.*\\.com/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/user=.*\\.com/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/user=.*\\.com/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/user=.*\\.com/g", "content-length: 35263", 21, 0, 0, 0},
+{"/user=.*\\.com/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/user=.*\\.com/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/user=.*\\.com/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/user=.*\\.com/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/user=.*\\.com/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/user=.*\\.com/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/user=.*\\.com/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/user=.*\\.com/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/user=.*\\.com/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/user=.*\\.com/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/user=.*\\.com/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/user=.*\\.com/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/user=.*\\.com/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/user=.*\\.com/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/user=.*\\.com/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/user=.*\\.com/g", "", 0, 0, 0, 0},
+{"/user=.*\\.com/g", "a", 1, 0, 0, 0},
+{"/user=.*\\.com/g", "ab", 2, 0, 0, 0},
+{"/user=.*\\.com/g", "abc", 3, 0, 0, 0},
+{"/user=.*\\.com/g", "aab", 3, 0, 0, 0},
+{"/user=.*\\.com/g", "abcd", 4, 0, 0, 0},
+{"/user=.*\\.com/g", "aaab", 4, 0, 0, 0},
+{"/user=.*\\.com/g", "AAB", 3, 0, 0, 0},
+{"/user=.*\\.com/g", "xyz", 3, 0, 0, 0},
+{"/user=.*\\.com/g", "xz", 2, 0, 0, 0},
+{"/user=.*\\.com/g", "zzy", 3, 0, 0, 0},
+{"/user=.*\\.com/g", "ab ab", 5, 0, 0, 0},
+{"/user=.*\\.com/g", "acbcd", 5, 0, 0, 0},
+{"/user=.*\\.com/g", "ababc", 5, 0, 0, 0},
+{"/user=.*\\.com/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/user=.*\\.com/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/user=.*\\.com/g", "b1a ba1", 7, 0, 0, 0},
+{"/user=.*\\.com/g", "12:34:56", 8, 0, 0, 0},
+{"/user=.*\\.com/g", "#$%", 3, 0, 0, 0},
+{"/user=.*\\.com/g", " \011word", 6, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 41, 6},
+{"/GET|POST|PUT|DELETE/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 42, 3},
+{"/GET|POST|PUT|DELETE/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 42, 3},
+{"/GET|POST|PUT|DELETE/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 41, 6},
+{"/GET|POST|PUT|DELETE/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 41, 4},
+{"/GET|POST|PUT|DELETE/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 42, 6},
+{"/GET|POST|PUT|DELETE/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 0, 6},
+{"/GET|POST|PUT|DELETE/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "content-length: 35263", 21, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "", 0, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "a", 1, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "ab", 2, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "abc", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aab", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "abcd", 4, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaab", 4, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "AAB", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "xyz", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "xz", 2, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "zzy", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "ab ab", 5, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "acbcd", 5, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "ababc", 5, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "b1a ba1", 7, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "12:34:56", 8, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", "#$%", 3, 0, 0, 0},
+{"/GET|POST|PUT|DELETE/g", " \011word", 6, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "Content-Length: 38584", 21, 1, 0, 21},
+{"/^Content-Length: \\d+/g", "content-length: 35263", 21, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "", 0, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "a", 1, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "ab", 2, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "abc", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aab", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "abcd", 4, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaab", 4, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "AAB", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "xyz", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "xz", 2, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "zzy", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "ab ab", 5, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "acbcd", 5, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "ababc", 5, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "b1a ba1", 7, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "12:34:56", 8, 0, 0, 0},
+{"/^Content-Length: \\d+/g", "#$%", 3, 0, 0, 0},
+{"/^Content-Length: \\d+/g", " \011word", 6, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/content-length: \\d+/gi", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/content-length: \\d+/gi", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/content-length: \\d+/gi", "Host: www.mail.com", 18, 0, 0, 0},
+{"/content-length: \\d+/gi", "Content-Length: 38584", 21, 1, 0, 21},
+{"/content-length: \\d+/gi", "content-length: 35263", 21, 1, 0, 21},
+{"/content-length: \\d+/gi", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/content-length: \\d+/gi", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/content-length: \\d+/gi", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/content-length: \\d+/gi", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/content-length: \\d+/gi", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/content-length: \\d+/gi", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/content-length: \\d+/gi", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/content-length: \\d+/gi", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/content-length: \\d+/gi", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/content-length: \\d+/gi", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/content-length: \\d+/gi", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/content-length: \\d+/gi", "", 0, 0, 0, 0},
+{"/content-length: \\d+/gi", "a", 1, 0, 0, 0},
+{"/content-length: \\d+/gi", "ab", 2, 0, 0, 0},
+{"/content-length: \\d+/gi", "abc", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", "aab", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", "abcd", 4, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaab", 4, 0, 0, 0},
+{"/content-length: \\d+/gi", "AAB", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", "xyz", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", "xz", 2, 0, 0, 0},
+{"/content-length: \\d+/gi", "zzy", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", "ab ab", 5, 0, 0, 0},
+{"/content-length: \\d+/gi", "acbcd", 5, 0, 0, 0},
+{"/content-length: \\d+/gi", "ababc", 5, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/content-length: \\d+/gi", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/content-length: \\d+/gi", "b1a ba1", 7, 0, 0, 0},
+{"/content-length: \\d+/gi", "12:34:56", 8, 0, 0, 0},
+{"/content-length: \\d+/gi", "#$%", 3, 0, 0, 0},
+{"/content-length: \\d+/gi", " \011word", 6, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 81, 9},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 77, 9},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 79, 8},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 81, 9},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 76, 12},
+{"/([a-z]+)=([a-z0-9]+)/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 82, 12},
+{"/([a-z]+)=([a-z0-9]+)/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "content-length: 35263", 21, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 8, 10},
+{"/([a-z]+)=([a-z0-9]+)/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "", 0, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "a", 1, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "ab", 2, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "abc", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aab", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "abcd", 4, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaab", 4, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "AAB", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "xyz", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "xz", 2, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "zzy", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "ab ab", 5, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "acbcd", 5, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "ababc", 5, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "b1a ba1", 7, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "12:34:56", 8, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", "#$%", 3, 0, 0, 0},
+{"/([a-z]+)=([a-z0-9]+)/g", " \011word", 6, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 0, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "content-length: 35263", 21, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 26, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 29, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 29, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 29, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 27, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 26, 10},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "", 0, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "a", 1, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "ab", 2, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "abc", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aab", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "abcd", 4, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaab", 4, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "AAB", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "xyz", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "xz", 2, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "zzy", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "ab ab", 5, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "acbcd", 5, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "ababc", 5, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "b1a ba1", 7, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "12:34:56", 8, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", "#$%", 3, 0, 0, 0},
+{"/\\d{4}-\\d{2}-\\d{2}/g", " \011word", 6, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 86, 13},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 82, 13},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 84, 12},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 86, 13},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 81, 16},
+{"/[a-z]+@[a-z]+\\.com/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 87, 16},
+{"/[a-z]+@[a-z]+\\.com/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "content-length: 35263", 21, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 11, 14},
+{"/[a-z]+@[a-z]+\\.com/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 12, 16},
+{"/[a-z]+@[a-z]+\\.com/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 14, 14},
+{"/[a-z]+@[a-z]+\\.com/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 12, 16},
+{"/[a-z]+@[a-z]+\\.com/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 10, 16},
+{"/[a-z]+@[a-z]+\\.com/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 11, 14},
+{"/[a-z]+@[a-z]+\\.com/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "", 0, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "a", 1, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "ab", 2, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "abc", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aab", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "abcd", 4, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaab", 4, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "AAB", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "xyz", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "xz", 2, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "zzy", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "ab ab", 5, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "acbcd", 5, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "ababc", 5, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "b1a ba1", 7, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "12:34:56", 8, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", "#$%", 3, 0, 0, 0},
+{"/[a-z]+@[a-z]+\\.com/g", " \011word", 6, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "content-length: 35263", 21, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "", 0, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "a", 1, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "ab", 2, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "abc", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aab", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "abcd", 4, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaab", 4, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "AAB", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "xyz", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "xz", 2, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "zzy", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "ab ab", 5, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "acbcd", 5, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "ababc", 5, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "b1a ba1", 7, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "12:34:56", 8, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", "#$%", 3, 0, 0, 0},
+{"/,\\d+\\.\\d{2},PAID$/g", " \011word", 6, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 0, 10},
+{"/(\\d+,)(\\w+)/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 0, 11},
+{"/(\\d+,)(\\w+)/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 0, 13},
+{"/(\\d+,)(\\w+)/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 0, 11},
+{"/(\\d+,)(\\w+)/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 0, 9},
+{"/(\\d+,)(\\w+)/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 0, 10},
+{"/(\\d+,)(\\w+)/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "", 0, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "a", 1, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "ab", 2, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "abc", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aab", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "abcd", 4, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaab", 4, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "AAB", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "xyz", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "xz", 2, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "zzy", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "ab ab", 5, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "acbcd", 5, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "ababc", 5, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "b1a ba1", 7, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "12:34:56", 8, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", "#$%", 3, 0, 0, 0},
+{"/(\\d+,)(\\w+)/g", " \011word", 6, 0, 0, 0},
+{"/\\d++,/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/\\d++,/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/\\d++,/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/\\d++,/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/\\d++,/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/\\d++,/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/\\d++,/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/\\d++,/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/\\d++,/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/\\d++,/g", "content-length: 35263", 21, 0, 0, 0},
+{"/\\d++,/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/\\d++,/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/\\d++,/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/\\d++,/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 0, 6},
+{"/\\d++,/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 0, 6},
+{"/\\d++,/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 0, 6},
+{"/\\d++,/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 0, 6},
+{"/\\d++,/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 0, 6},
+{"/\\d++,/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 0, 6},
+{"/\\d++,/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/\\d++,/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/\\d++,/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/\\d++,/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/\\d++,/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\d++,/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/\\d++,/g", "", 0, 0, 0, 0},
+{"/\\d++,/g", "a", 1, 0, 0, 0},
+{"/\\d++,/g", "ab", 2, 0, 0, 0},
+{"/\\d++,/g", "abc", 3, 0, 0, 0},
+{"/\\d++,/g", "aab", 3, 0, 0, 0},
+{"/\\d++,/g", "abcd", 4, 0, 0, 0},
+{"/\\d++,/g", "aaab", 4, 0, 0, 0},
+{"/\\d++,/g", "AAB", 3, 0, 0, 0},
+{"/\\d++,/g", "xyz", 3, 0, 0, 0},
+{"/\\d++,/g", "xz", 2, 0, 0, 0},
+{"/\\d++,/g", "zzy", 3, 0, 0, 0},
+{"/\\d++,/g", "ab ab", 5, 0, 0, 0},
+{"/\\d++,/g", "acbcd", 5, 0, 0, 0},
+{"/\\d++,/g", "ababc", 5, 0, 0, 0},
+{"/\\d++,/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\d++,/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\d++,/g", "b1a ba1", 7, 0, 0, 0},
+{"/\\d++,/g", "12:34:56", 8, 0, 0, 0},
+{"/\\d++,/g", "#$%", 3, 0, 0, 0},
+{"/\\d++,/g", " \011word", 6, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/(a|aa)+b/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/(a|aa)+b/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(a|aa)+b/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(a|aa)+b/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(a|aa)+b/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(a|aa)+b/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(a|aa)+b/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(a|aa)+b/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(a|aa)+b/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/(a|aa)+b/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/(a|aa)+b/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/(a|aa)+b/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/(a|aa)+b/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/(a|aa)+b/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/(a|aa)+b/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(a|aa)+b/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(a|aa)+b/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(a|aa)+b/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(a|aa)+b/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 17},
+{"/(a|aa)+b/g", "aaaaaaaaaa1ab", 13, 1, 11, 2},
+{"/(a|aa)+b/g", "", 0, 0, 0, 0},
+{"/(a|aa)+b/g", "a", 1, 0, 0, 0},
+{"/(a|aa)+b/g", "ab", 2, 1, 0, 2},
+{"/(a|aa)+b/g", "abc", 3, 1, 0, 2},
+{"/(a|aa)+b/g", "aab", 3, 1, 0, 3},
+{"/(a|aa)+b/g", "abcd", 4, 1, 0, 2},
+{"/(a|aa)+b/g", "aaab", 4, 1, 0, 4},
+{"/(a|aa)+b/g", "AAB", 3, 0, 0, 0},
+{"/(a|aa)+b/g", "xyz", 3, 0, 0, 0},
+{"/(a|aa)+b/g", "xz", 2, 0, 0, 0},
+{"/(a|aa)+b/g", "zzy", 3, 0, 0, 0},
+{"/(a|aa)+b/g", "ab ab", 5, 1, 0, 2},
+{"/(a|aa)+b/g", "acbcd", 5, 0, 0, 0},
+{"/(a|aa)+b/g", "ababc", 5, 1, 0, 2},
+{"/(a|aa)+b/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(a|aa)+b/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 16},
+{"/(a|aa)+b/g", "b1a ba1", 7, 0, 0, 0},
+{"/(a|aa)+b/g", "12:34:56", 8, 0, 0, 0},
+{"/(a|aa)+b/g", "#$%", 3, 0, 0, 0},
+{"/(a|aa)+b/g", " \011word", 6, 0, 0, 0},
+{"/(a*)*b/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/(a*)*b/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/(a*)*b/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 84, 1},
+{"/(a*)*b/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/(a*)*b/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/(a*)*b/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/(a*)*b/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(a*)*b/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(a*)*b/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(a*)*b/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(a*)*b/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(a*)*b/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 16, 1},
+{"/(a*)*b/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 16, 1},
+{"/(a*)*b/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/(a*)*b/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/(a*)*b/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/(a*)*b/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/(a*)*b/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 6, 1},
+{"/(a*)*b/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/(a*)*b/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(a*)*b/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(a*)*b/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(a*)*b/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(a*)*b/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 17},
+{"/(a*)*b/g", "aaaaaaaaaa1ab", 13, 1, 11, 2},
+{"/(a*)*b/g", "", 0, 0, 0, 0},
+{"/(a*)*b/g", "a", 1, 0, 0, 0},
+{"/(a*)*b/g", "ab", 2, 1, 0, 2},
+{"/(a*)*b/g", "abc", 3, 1, 0, 2},
+{"/(a*)*b/g", "aab", 3, 1, 0, 3},
+{"/(a*)*b/g", "abcd", 4, 1, 0, 2},
+{"/(a*)*b/g", "aaab", 4, 1, 0, 4},
+{"/(a*)*b/g", "AAB", 3, 0, 0, 0},
+{"/(a*)*b/g", "xyz", 3, 0, 0, 0},
+{"/(a*)*b/g", "xz", 2, 0, 0, 0},
+{"/(a*)*b/g", "zzy", 3, 0, 0, 0},
+{"/(a*)*b/g", "ab ab", 5, 1, 0, 2},
+{"/(a*)*b/g", "acbcd", 5, 1, 2, 1},
+{"/(a*)*b/g", "ababc", 5, 1, 0, 2},
+{"/(a*)*b/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(a*)*b/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 16},
+{"/(a*)*b/g", "b1a ba1", 7, 1, 0, 1},
+{"/(a*)*b/g", "12:34:56", 8, 0, 0, 0},
+{"/(a*)*b/g", "#$%", 3, 0, 0, 0},
+{"/(a*)*b/g", " \011word", 6, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 84, 1},
+{"/a*a*a*a*a*a*b/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "content-length: 35263", 21, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 16, 1},
+{"/a*a*a*a*a*a*b/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 16, 1},
+{"/a*a*a*a*a*a*b/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 6, 1},
+{"/a*a*a*a*a*a*b/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 17},
+{"/a*a*a*a*a*a*b/g", "aaaaaaaaaa1ab", 13, 1, 11, 2},
+{"/a*a*a*a*a*a*b/g", "", 0, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "a", 1, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "ab", 2, 1, 0, 2},
+{"/a*a*a*a*a*a*b/g", "abc", 3, 1, 0, 2},
+{"/a*a*a*a*a*a*b/g", "aab", 3, 1, 0, 3},
+{"/a*a*a*a*a*a*b/g", "abcd", 4, 1, 0, 2},
+{"/a*a*a*a*a*a*b/g", "aaab", 4, 1, 0, 4},
+{"/a*a*a*a*a*a*b/g", "AAB", 3, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "xyz", 3, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "xz", 2, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "zzy", 3, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "ab ab", 5, 1, 0, 2},
+{"/a*a*a*a*a*a*b/g", "acbcd", 5, 1, 2, 1},
+{"/a*a*a*a*a*a*b/g", "ababc", 5, 1, 0, 2},
+{"/a*a*a*a*a*a*b/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 16},
+{"/a*a*a*a*a*a*b/g", "b1a ba1", 7, 1, 0, 1},
+{"/a*a*a*a*a*a*b/g", "12:34:56", 8, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", "#$%", 3, 0, 0, 0},
+{"/a*a*a*a*a*a*b/g", " \011word", 6, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 30, 5},
+{"/(\\w+\\d\?)+x/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 17, 2},
+{"/(\\w+\\d\?)+x/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 15, 2},
+{"/(\\w+\\d\?)+x/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaaaaa1aaa1x", 12, 1, 0, 12},
+{"/(\\w+\\d\?)+x/g", "a11aaaaaaaaaaaax", 16, 1, 0, 16},
+{"/(\\w+\\d\?)+x/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "", 0, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "a", 1, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "ab", 2, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "abc", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aab", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "abcd", 4, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaab", 4, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "AAB", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "xyz", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "xz", 2, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "zzy", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "ab ab", 5, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "acbcd", 5, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "ababc", 5, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "b1a ba1", 7, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "12:34:56", 8, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", "#$%", 3, 0, 0, 0},
+{"/(\\w+\\d\?)+x/g", " \011word", 6, 0, 0, 0},
+{"/a+b+c+/gi", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/a+b+c+/gi", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/a+b+c+/gi", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/a+b+c+/gi", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/a+b+c+/gi", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/a+b+c+/gi", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/a+b+c+/gi", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/a+b+c+/gi", "Host: www.mail.com", 18, 0, 0, 0},
+{"/a+b+c+/gi", "Content-Length: 38584", 21, 0, 0, 0},
+{"/a+b+c+/gi", "content-length: 35263", 21, 0, 0, 0},
+{"/a+b+c+/gi", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/a+b+c+/gi", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/a+b+c+/gi", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/a+b+c+/gi", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/a+b+c+/gi", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/a+b+c+/gi", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/a+b+c+/gi", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/a+b+c+/gi", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/a+b+c+/gi", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/a+b+c+/gi", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/a+b+c+/gi", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/a+b+c+/gi", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/a+b+c+/gi", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/a+b+c+/gi", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/a+b+c+/gi", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/a+b+c+/gi", "", 0, 0, 0, 0},
+{"/a+b+c+/gi", "a", 1, 0, 0, 0},
+{"/a+b+c+/gi", "ab", 2, 0, 0, 0},
+{"/a+b+c+/gi", "abc", 3, 1, 0, 3},
+{"/a+b+c+/gi", "aab", 3, 0, 0, 0},
+{"/a+b+c+/gi", "abcd", 4, 1, 0, 3},
+{"/a+b+c+/gi", "aaab", 4, 0, 0, 0},
+{"/a+b+c+/gi", "AAB", 3, 0, 0, 0},
+{"/a+b+c+/gi", "xyz", 3, 0, 0, 0},
+{"/a+b+c+/gi", "xz", 2, 0, 0, 0},
+{"/a+b+c+/gi", "zzy", 3, 0, 0, 0},
+{"/a+b+c+/gi", "ab ab", 5, 0, 0, 0},
+{"/a+b+c+/gi", "acbcd", 5, 0, 0, 0},
+{"/a+b+c+/gi", "ababc", 5, 1, 2, 3},
+{"/a+b+c+/gi", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/a+b+c+/gi", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/a+b+c+/gi", "b1a ba1", 7, 0, 0, 0},
+{"/a+b+c+/gi", "12:34:56", 8, 0, 0, 0},
+{"/a+b+c+/gi", "#$%", 3, 0, 0, 0},
+{"/a+b+c+/gi", " \011word", 6, 0, 0, 0},
+{"/x|y|z/gi", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/x|y|z/gi", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/x|y|z/gi", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/x|y|z/gi", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/x|y|z/gi", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 87, 1},
+{"/x|y|z/gi", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 93, 1},
+{"/x|y|z/gi", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/x|y|z/gi", "Host: www.mail.com", 18, 0, 0, 0},
+{"/x|y|z/gi", "Content-Length: 38584", 21, 0, 0, 0},
+{"/x|y|z/gi", "content-length: 35263", 21, 0, 0, 0},
+{"/x|y|z/gi", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 14, 1},
+{"/x|y|z/gi", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/x|y|z/gi", "X-Request-Id: 4cb851-ea9c", 25, 1, 0, 1},
+{"/x|y|z/gi", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/x|y|z/gi", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 18, 1},
+{"/x|y|z/gi", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 12, 1},
+{"/x|y|z/gi", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 18, 1},
+{"/x|y|z/gi", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 16, 1},
+{"/x|y|z/gi", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/x|y|z/gi", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/x|y|z/gi", "aaaaaa1aaa1x", 12, 1, 11, 1},
+{"/x|y|z/gi", "a11aaaaaaaaaaaax", 16, 1, 15, 1},
+{"/x|y|z/gi", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/x|y|z/gi", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/x|y|z/gi", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/x|y|z/gi", "", 0, 0, 0, 0},
+{"/x|y|z/gi", "a", 1, 0, 0, 0},
+{"/x|y|z/gi", "ab", 2, 0, 0, 0},
+{"/x|y|z/gi", "abc", 3, 0, 0, 0},
+{"/x|y|z/gi", "aab", 3, 0, 0, 0},
+{"/x|y|z/gi", "abcd", 4, 0, 0, 0},
+{"/x|y|z/gi", "aaab", 4, 0, 0, 0},
+{"/x|y|z/gi", "AAB", 3, 0, 0, 0},
+{"/x|y|z/gi", "xyz", 3, 1, 0, 1},
+{"/x|y|z/gi", "xz", 2, 1, 0, 1},
+{"/x|y|z/gi", "zzy", 3, 1, 0, 1},
+{"/x|y|z/gi", "ab ab", 5, 0, 0, 0},
+{"/x|y|z/gi", "acbcd", 5, 0, 0, 0},
+{"/x|y|z/gi", "ababc", 5, 0, 0, 0},
+{"/x|y|z/gi", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/x|y|z/gi", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/x|y|z/gi", "b1a ba1", 7, 0, 0, 0},
+{"/x|y|z/gi", "12:34:56", 8, 0, 0, 0},
+{"/x|y|z/gi", "#$%", 3, 0, 0, 0},
+{"/x|y|z/gi", " \011word", 6, 0, 0, 0},
+{"/[a-z]+q*/gi", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 24, 4},
+{"/[a-z]+q*/gi", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 24, 4},
+{"/[a-z]+q*/gi", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 24, 4},
+{"/[a-z]+q*/gi", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 24, 5},
+{"/[a-z]+q*/gi", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 24, 5},
+{"/[a-z]+q*/gi", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 24, 4},
+{"/[a-z]+q*/gi", "DELETE /carts/443 HTTP/1.1", 26, 1, 0, 6},
+{"/[a-z]+q*/gi", "Host: www.mail.com", 18, 1, 0, 4},
+{"/[a-z]+q*/gi", "Content-Length: 38584", 21, 1, 0, 7},
+{"/[a-z]+q*/gi", "content-length: 35263", 21, 1, 0, 7},
+{"/[a-z]+q*/gi", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 0, 4},
+{"/[a-z]+q*/gi", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 0, 6},
+{"/[a-z]+q*/gi", "X-Request-Id: 4cb851-ea9c", 25, 1, 0, 1},
+{"/[a-z]+q*/gi", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 6, 4},
+{"/[a-z]+q*/gi", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 6, 5},
+{"/[a-z]+q*/gi", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 6, 7},
+{"/[a-z]+q*/gi", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 6, 5},
+{"/[a-z]+q*/gi", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 6, 3},
+{"/[a-z]+q*/gi", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 6, 4},
+{"/[a-z]+q*/gi", "aa1aaaaaaaaa\?", 13, 1, 0, 2},
+{"/[a-z]+q*/gi", "aaaaaa1aaa1x", 12, 1, 0, 6},
+{"/[a-z]+q*/gi", "a11aaaaaaaaaaaax", 16, 1, 0, 1},
+{"/[a-z]+q*/gi", "aaa1aa11aaa1a\?", 14, 1, 0, 3},
+{"/[a-z]+q*/gi", "aaaaaaaaaaaaaaaab", 17, 1, 0, 17},
+{"/[a-z]+q*/gi", "aaaaaaaaaa1ab", 13, 1, 0, 10},
+{"/[a-z]+q*/gi", "", 0, 0, 0, 0},
+{"/[a-z]+q*/gi", "a", 1, 1, 0, 1},
+{"/[a-z]+q*/gi", "ab", 2, 1, 0, 2},
+{"/[a-z]+q*/gi", "abc", 3, 1, 0, 3},
+{"/[a-z]+q*/gi", "aab", 3, 1, 0, 3},
+{"/[a-z]+q*/gi", "abcd", 4, 1, 0, 4},
+{"/[a-z]+q*/gi", "aaab", 4, 1, 0, 4},
+{"/[a-z]+q*/gi", "AAB", 3, 1, 0, 3},
+{"/[a-z]+q*/gi", "xyz", 3, 1, 0, 3},
+{"/[a-z]+q*/gi", "xz", 2, 1, 0, 2},
+{"/[a-z]+q*/gi", "zzy", 3, 1, 0, 3},
+{"/[a-z]+q*/gi", "ab ab", 5, 1, 0, 2},
+{"/[a-z]+q*/gi", "acbcd", 5, 1, 0, 5},
+{"/[a-z]+q*/gi", "ababc", 5, 1, 0, 5},
+{"/[a-z]+q*/gi", "aaaaaaaaaaaaaaaa", 16, 1, 0, 16},
+{"/[a-z]+q*/gi", "aaaaaaaaaaaaaaab", 16, 1, 0, 16},
+{"/[a-z]+q*/gi", "b1a ba1", 7, 1, 0, 1},
+{"/[a-z]+q*/gi", "12:34:56", 8, 0, 0, 0},
+{"/[a-z]+q*/gi", "#$%", 3, 0, 0, 0},
+{"/[a-z]+q*/gi", " \011word", 6, 1, 2, 4},
+{"/(get|post) \\/[a-z]+/gi", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 42, 8},
+{"/(get|post) \\/[a-z]+/gi", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 42, 8},
+{"/(get|post) \\/[a-z]+/gi", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 41, 9},
+{"/(get|post) \\/[a-z]+/gi", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "content-length: 35263", 21, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "", 0, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "a", 1, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "ab", 2, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "abc", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aab", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "abcd", 4, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaab", 4, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "AAB", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "xyz", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "xz", 2, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "zzy", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "ab ab", 5, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "acbcd", 5, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "ababc", 5, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "b1a ba1", 7, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "12:34:56", 8, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", "#$%", 3, 0, 0, 0},
+{"/(get|post) \\/[a-z]+/gi", " \011word", 6, 0, 0, 0},
+{"/^\\d+$/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/^\\d+$/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/^\\d+$/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/^\\d+$/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/^\\d+$/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/^\\d+$/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/^\\d+$/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/^\\d+$/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/^\\d+$/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/^\\d+$/g", "content-length: 35263", 21, 0, 0, 0},
+{"/^\\d+$/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/^\\d+$/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/^\\d+$/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/^\\d+$/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/^\\d+$/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/^\\d+$/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/^\\d+$/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/^\\d+$/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/^\\d+$/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/^\\d+$/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/^\\d+$/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/^\\d+$/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/^\\d+$/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/^\\d+$/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/^\\d+$/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/^\\d+$/g", "", 0, 0, 0, 0},
+{"/^\\d+$/g", "a", 1, 0, 0, 0},
+{"/^\\d+$/g", "ab", 2, 0, 0, 0},
+{"/^\\d+$/g", "abc", 3, 0, 0, 0},
+{"/^\\d+$/g", "aab", 3, 0, 0, 0},
+{"/^\\d+$/g", "abcd", 4, 0, 0, 0},
+{"/^\\d+$/g", "aaab", 4, 0, 0, 0},
+{"/^\\d+$/g", "AAB", 3, 0, 0, 0},
+{"/^\\d+$/g", "xyz", 3, 0, 0, 0},
+{"/^\\d+$/g", "xz", 2, 0, 0, 0},
+{"/^\\d+$/g", "zzy", 3, 0, 0, 0},
+{"/^\\d+$/g", "ab ab", 5, 0, 0, 0},
+{"/^\\d+$/g", "acbcd", 5, 0, 0, 0},
+{"/^\\d+$/g", "ababc", 5, 0, 0, 0},
+{"/^\\d+$/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/^\\d+$/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/^\\d+$/g", "b1a ba1", 7, 0, 0, 0},
+{"/^\\d+$/g", "12:34:56", 8, 0, 0, 0},
+{"/^\\d+$/g", "#$%", 3, 0, 0, 0},
+{"/^\\d+$/g", " \011word", 6, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "content-length: 35263", 21, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "", 0, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "a", 1, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "ab", 2, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "abc", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aab", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "abcd", 4, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaab", 4, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "AAB", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "xyz", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "xz", 2, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "zzy", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "ab ab", 5, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "acbcd", 5, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "ababc", 5, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "b1a ba1", 7, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "12:34:56", 8, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", "#$%", 3, 0, 0, 0},
+{"/^(GET|POST) \\/\\w+/g", " \011word", 6, 0, 0, 0},
+{"/\\s+\\S+$/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 80, 19},
+{"/\\s+\\S+$/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 76, 19},
+{"/\\s+\\S+$/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 78, 18},
+{"/\\s+\\S+$/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 80, 19},
+{"/\\s+\\S+$/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 75, 22},
+{"/\\s+\\S+$/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 81, 22},
+{"/\\s+\\S+$/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 17, 9},
+{"/\\s+\\S+$/g", "Host: www.mail.com", 18, 1, 5, 13},
+{"/\\s+\\S+$/g", "Content-Length: 38584", 21, 1, 15, 6},
+{"/\\s+\\S+$/g", "content-length: 35263", 21, 1, 15, 6},
+{"/\\s+\\S+$/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 43, 13},
+{"/\\s+\\S+$/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 31, 8},
+{"/\\s+\\S+$/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 13, 12},
+{"/\\s+\\S+$/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/\\s+\\S+$/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/\\s+\\S+$/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/\\s+\\S+$/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/\\s+\\S+$/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/\\s+\\S+$/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/\\s+\\S+$/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/\\s+\\S+$/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/\\s+\\S+$/g", "", 0, 0, 0, 0},
+{"/\\s+\\S+$/g", "a", 1, 0, 0, 0},
+{"/\\s+\\S+$/g", "ab", 2, 0, 0, 0},
+{"/\\s+\\S+$/g", "abc", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", "aab", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", "abcd", 4, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaab", 4, 0, 0, 0},
+{"/\\s+\\S+$/g", "AAB", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", "xyz", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", "xz", 2, 0, 0, 0},
+{"/\\s+\\S+$/g", "zzy", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", "ab ab", 5, 1, 2, 3},
+{"/\\s+\\S+$/g", "acbcd", 5, 0, 0, 0},
+{"/\\s+\\S+$/g", "ababc", 5, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\s+\\S+$/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\s+\\S+$/g", "b1a ba1", 7, 1, 3, 4},
+{"/\\s+\\S+$/g", "12:34:56", 8, 0, 0, 0},
+{"/\\s+\\S+$/g", "#$%", 3, 0, 0, 0},
+{"/\\s+\\S+$/g", " \011word", 6, 1, 0, 6},
+{"/[^a-z0-9 ]+/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 4, 1},
+{"/[^a-z0-9 ]+/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 0, 6},
+{"/[^a-z0-9 ]+/g", "Host: www.mail.com", 18, 1, 0, 1},
+{"/[^a-z0-9 ]+/g", "Content-Length: 38584", 21, 1, 0, 1},
+{"/[^a-z0-9 ]+/g", "content-length: 35263", 21, 1, 7, 1},
+{"/[^a-z0-9 ]+/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 0, 1},
+{"/[^a-z0-9 ]+/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 0, 1},
+{"/[^a-z0-9 ]+/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 0, 3},
+{"/[^a-z0-9 ]+/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 5, 1},
+{"/[^a-z0-9 ]+/g", "aa1aaaaaaaaa\?", 13, 1, 12, 1},
+{"/[^a-z0-9 ]+/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aaa1aa11aaa1a\?", 14, 1, 13, 1},
+{"/[^a-z0-9 ]+/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "", 0, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "a", 1, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "ab", 2, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "abc", 3, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aab", 3, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "abcd", 4, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aaab", 4, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "AAB", 3, 1, 0, 3},
+{"/[^a-z0-9 ]+/g", "xyz", 3, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "xz", 2, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "zzy", 3, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "ab ab", 5, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "acbcd", 5, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "ababc", 5, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "b1a ba1", 7, 0, 0, 0},
+{"/[^a-z0-9 ]+/g", "12:34:56", 8, 1, 2, 1},
+{"/[^a-z0-9 ]+/g", "#$%", 3, 1, 0, 3},
+{"/[^a-z0-9 ]+/g", " \011word", 6, 1, 1, 1},
+{"/\\W\\w{3}\\W/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 19, 5},
+{"/\\W\\w{3}\\W/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 13, 5},
+{"/\\W\\w{3}\\W/g", "Host: www.mail.com", 18, 1, 5, 5},
+{"/\\W\\w{3}\\W/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "content-length: 35263", 21, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 24, 5},
+{"/\\W\\w{3}\\W/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 7, 5},
+{"/\\W\\w{3}\\W/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 21, 5},
+{"/\\W\\w{3}\\W/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 24, 5},
+{"/\\W\\w{3}\\W/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 24, 5},
+{"/\\W\\w{3}\\W/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 24, 5},
+{"/\\W\\w{3}\\W/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 5, 5},
+{"/\\W\\w{3}\\W/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 21, 5},
+{"/\\W\\w{3}\\W/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "", 0, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "a", 1, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "ab", 2, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "abc", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aab", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "abcd", 4, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaab", 4, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "AAB", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "xyz", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "xz", 2, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "zzy", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "ab ab", 5, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "acbcd", 5, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "ababc", 5, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "b1a ba1", 7, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "12:34:56", 8, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", "#$%", 3, 0, 0, 0},
+{"/\\W\\w{3}\\W/g", " \011word", 6, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "content-length: 35263", 21, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 14, 11},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "", 0, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "a", 1, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "ab", 2, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "abc", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aab", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "abcd", 4, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaab", 4, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "AAB", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "xyz", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "xz", 2, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "zzy", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "ab ab", 5, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "acbcd", 5, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "ababc", 5, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "b1a ba1", 7, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "12:34:56", 8, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", "#$%", 3, 0, 0, 0},
+{"/[0-9a-f]{6}-[0-9a-f]{4}/g", " \011word", 6, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 11, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "", 0, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "a", 1, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "ab", 2, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "abc", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aab", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "abcd", 4, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaab", 4, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "AAB", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "xyz", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "xz", 2, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "zzy", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "ab ab", 5, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "acbcd", 5, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "ababc", 5, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "b1a ba1", 7, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", "12:34:56", 8, 1, 0, 8},
+{"/(\\d{2}:){2}\\d{2}/g", "#$%", 3, 0, 0, 0},
+{"/(\\d{2}:){2}\\d{2}/g", " \011word", 6, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 49, 1},
+{"/(ab|a)(bc|c)\?/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 47, 1},
+{"/(ab|a)(bc|c)\?/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 47, 1},
+{"/(ab|a)(bc|c)\?/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 49, 1},
+{"/(ab|a)(bc|c)\?/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 47, 1},
+{"/(ab|a)(bc|c)\?/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 50, 1},
+{"/(ab|a)(bc|c)\?/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 9, 1},
+{"/(ab|a)(bc|c)\?/g", "Host: www.mail.com", 18, 1, 11, 1},
+{"/(ab|a)(bc|c)\?/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 18, 1},
+{"/(ab|a)(bc|c)\?/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 27, 1},
+{"/(ab|a)(bc|c)\?/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 22, 1},
+{"/(ab|a)(bc|c)\?/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 7, 1},
+{"/(ab|a)(bc|c)\?/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 13, 1},
+{"/(ab|a)(bc|c)\?/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 7, 1},
+{"/(ab|a)(bc|c)\?/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 6, 1},
+{"/(ab|a)(bc|c)\?/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 11, 1},
+{"/(ab|a)(bc|c)\?/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 18, 1},
+{"/(ab|a)(bc|c)\?/g", "aa1aaaaaaaaa\?", 13, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "aaaaaa1aaa1x", 12, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "a11aaaaaaaaaaaax", 16, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "aaa1aa11aaa1a\?", 14, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "aaaaaaaaaa1ab", 13, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "", 0, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "a", 1, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "ab", 2, 1, 0, 2},
+{"/(ab|a)(bc|c)\?/g", "abc", 3, 1, 0, 3},
+{"/(ab|a)(bc|c)\?/g", "aab", 3, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "abcd", 4, 1, 0, 3},
+{"/(ab|a)(bc|c)\?/g", "aaab", 4, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "AAB", 3, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "xyz", 3, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "xz", 2, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "zzy", 3, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "ab ab", 5, 1, 0, 2},
+{"/(ab|a)(bc|c)\?/g", "acbcd", 5, 1, 0, 2},
+{"/(ab|a)(bc|c)\?/g", "ababc", 5, 1, 0, 2},
+{"/(ab|a)(bc|c)\?/g", "aaaaaaaaaaaaaaaa", 16, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 1},
+{"/(ab|a)(bc|c)\?/g", "b1a ba1", 7, 1, 2, 1},
+{"/(ab|a)(bc|c)\?/g", "12:34:56", 8, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", "#$%", 3, 0, 0, 0},
+{"/(ab|a)(bc|c)\?/g", " \011word", 6, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 96, 1},
+{"/(a|b)*c|a{2,}/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 54, 1},
+{"/(a|b)*c|a{2,}/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 88, 1},
+{"/(a|b)*c|a{2,}/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 96, 1},
+{"/(a|b)*c|a{2,}/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 94, 1},
+{"/(a|b)*c|a{2,}/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 95, 1},
+{"/(a|b)*c|a{2,}/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 8, 1},
+{"/(a|b)*c|a{2,}/g", "Host: www.mail.com", 18, 1, 15, 1},
+{"/(a|b)*c|a{2,}/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "content-length: 35263", 21, 1, 0, 1},
+{"/(a|b)*c|a{2,}/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 15, 1},
+{"/(a|b)*c|a{2,}/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 11, 1},
+{"/(a|b)*c|a{2,}/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 25, 1},
+{"/(a|b)*c|a{2,}/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 20, 1},
+{"/(a|b)*c|a{2,}/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 9, 1},
+{"/(a|b)*c|a{2,}/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 23, 1},
+{"/(a|b)*c|a{2,}/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 22, 1},
+{"/(a|b)*c|a{2,}/g", "aa1aaaaaaaaa\?", 13, 1, 0, 2},
+{"/(a|b)*c|a{2,}/g", "aaaaaa1aaa1x", 12, 1, 0, 6},
+{"/(a|b)*c|a{2,}/g", "a11aaaaaaaaaaaax", 16, 1, 3, 12},
+{"/(a|b)*c|a{2,}/g", "aaa1aa11aaa1a\?", 14, 1, 0, 3},
+{"/(a|b)*c|a{2,}/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 16},
+{"/(a|b)*c|a{2,}/g", "aaaaaaaaaa1ab", 13, 1, 0, 10},
+{"/(a|b)*c|a{2,}/g", "", 0, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "a", 1, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "ab", 2, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "abc", 3, 1, 0, 3},
+{"/(a|b)*c|a{2,}/g", "aab", 3, 1, 0, 2},
+{"/(a|b)*c|a{2,}/g", "abcd", 4, 1, 0, 3},
+{"/(a|b)*c|a{2,}/g", "aaab", 4, 1, 0, 3},
+{"/(a|b)*c|a{2,}/g", "AAB", 3, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "xyz", 3, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "xz", 2, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "zzy", 3, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "ab ab", 5, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "acbcd", 5, 1, 0, 2},
+{"/(a|b)*c|a{2,}/g", "ababc", 5, 1, 0, 5},
+{"/(a|b)*c|a{2,}/g", "aaaaaaaaaaaaaaaa", 16, 1, 0, 16},
+{"/(a|b)*c|a{2,}/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 15},
+{"/(a|b)*c|a{2,}/g", "b1a ba1", 7, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "12:34:56", 8, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", "#$%", 3, 0, 0, 0},
+{"/(a|b)*c|a{2,}/g", " \011word", 6, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 49, 1},
+{"/((a|b)c\?)+d\?/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 47, 1},
+{"/((a|b)c\?)+d\?/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 47, 1},
+{"/((a|b)c\?)+d\?/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 49, 1},
+{"/((a|b)c\?)+d\?/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 47, 1},
+{"/((a|b)c\?)+d\?/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 50, 1},
+{"/((a|b)c\?)+d\?/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 9, 1},
+{"/((a|b)c\?)+d\?/g", "Host: www.mail.com", 18, 1, 11, 1},
+{"/((a|b)c\?)+d\?/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "content-length: 35263", 21, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 18, 1},
+{"/((a|b)c\?)+d\?/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 16, 1},
+{"/((a|b)c\?)+d\?/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 16, 1},
+{"/((a|b)c\?)+d\?/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 7, 1},
+{"/((a|b)c\?)+d\?/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 13, 1},
+{"/((a|b)c\?)+d\?/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 7, 1},
+{"/((a|b)c\?)+d\?/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 6, 1},
+{"/((a|b)c\?)+d\?/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 6, 1},
+{"/((a|b)c\?)+d\?/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 18, 1},
+{"/((a|b)c\?)+d\?/g", "aa1aaaaaaaaa\?", 13, 1, 0, 2},
+{"/((a|b)c\?)+d\?/g", "aaaaaa1aaa1x", 12, 1, 0, 6},
+{"/((a|b)c\?)+d\?/g", "a11aaaaaaaaaaaax", 16, 1, 0, 1},
+{"/((a|b)c\?)+d\?/g", "aaa1aa11aaa1a\?", 14, 1, 0, 3},
+{"/((a|b)c\?)+d\?/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 17},
+{"/((a|b)c\?)+d\?/g", "aaaaaaaaaa1ab", 13, 1, 0, 10},
+{"/((a|b)c\?)+d\?/g", "", 0, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "a", 1, 1, 0, 1},
+{"/((a|b)c\?)+d\?/g", "ab", 2, 1, 0, 2},
+{"/((a|b)c\?)+d\?/g", "abc", 3, 1, 0, 3},
+{"/((a|b)c\?)+d\?/g", "aab", 3, 1, 0, 3},
+{"/((a|b)c\?)+d\?/g", "abcd", 4, 1, 0, 4},
+{"/((a|b)c\?)+d\?/g", "aaab", 4, 1, 0, 4},
+{"/((a|b)c\?)+d\?/g", "AAB", 3, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "xyz", 3, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "xz", 2, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "zzy", 3, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "ab ab", 5, 1, 0, 2},
+{"/((a|b)c\?)+d\?/g", "acbcd", 5, 1, 0, 5},
+{"/((a|b)c\?)+d\?/g", "ababc", 5, 1, 0, 5},
+{"/((a|b)c\?)+d\?/g", "aaaaaaaaaaaaaaaa", 16, 1, 0, 16},
+{"/((a|b)c\?)+d\?/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 16},
+{"/((a|b)c\?)+d\?/g", "b1a ba1", 7, 1, 0, 1},
+{"/((a|b)c\?)+d\?/g", "12:34:56", 8, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", "#$%", 3, 0, 0, 0},
+{"/((a|b)c\?)+d\?/g", " \011word", 6, 0, 0, 0},
+{"/x\?(y|z)*$/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 99, 0},
+{"/x\?(y|z)*$/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 95, 0},
+{"/x\?(y|z)*$/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 96, 0},
+{"/x\?(y|z)*$/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 99, 0},
+{"/x\?(y|z)*$/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 97, 0},
+{"/x\?(y|z)*$/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 103, 0},
+{"/x\?(y|z)*$/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 26, 0},
+{"/x\?(y|z)*$/g", "Host: www.mail.com", 18, 1, 18, 0},
+{"/x\?(y|z)*$/g", "Content-Length: 38584", 21, 1, 21, 0},
+{"/x\?(y|z)*$/g", "content-length: 35263", 21, 1, 21, 0},
+{"/x\?(y|z)*$/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 1, 56, 0},
+{"/x\?(y|z)*$/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 1, 39, 0},
+{"/x\?(y|z)*$/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 25, 0},
+{"/x\?(y|z)*$/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 48, 0},
+{"/x\?(y|z)*$/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 51, 0},
+{"/x\?(y|z)*$/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 51, 0},
+{"/x\?(y|z)*$/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 50, 0},
+{"/x\?(y|z)*$/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 49, 0},
+{"/x\?(y|z)*$/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 48, 0},
+{"/x\?(y|z)*$/g", "aa1aaaaaaaaa\?", 13, 1, 13, 0},
+{"/x\?(y|z)*$/g", "aaaaaa1aaa1x", 12, 1, 11, 1},
+{"/x\?(y|z)*$/g", "a11aaaaaaaaaaaax", 16, 1, 15, 1},
+{"/x\?(y|z)*$/g", "aaa1aa11aaa1a\?", 14, 1, 14, 0},
+{"/x\?(y|z)*$/g", "aaaaaaaaaaaaaaaab", 17, 1, 17, 0},
+{"/x\?(y|z)*$/g", "aaaaaaaaaa1ab", 13, 1, 13, 0},
+{"/x\?(y|z)*$/g", "", 0, 1, 0, 0},
+{"/x\?(y|z)*$/g", "a", 1, 1, 1, 0},
+{"/x\?(y|z)*$/g", "ab", 2, 1, 2, 0},
+{"/x\?(y|z)*$/g", "abc", 3, 1, 3, 0},
+{"/x\?(y|z)*$/g", "aab", 3, 1, 3, 0},
+{"/x\?(y|z)*$/g", "abcd", 4, 1, 4, 0},
+{"/x\?(y|z)*$/g", "aaab", 4, 1, 4, 0},
+{"/x\?(y|z)*$/g", "AAB", 3, 1, 3, 0},
+{"/x\?(y|z)*$/g", "xyz", 3, 1, 0, 3},
+{"/x\?(y|z)*$/g", "xz", 2, 1, 0, 2},
+{"/x\?(y|z)*$/g", "zzy", 3, 1, 0, 3},
+{"/x\?(y|z)*$/g", "ab ab", 5, 1, 5, 0},
+{"/x\?(y|z)*$/g", "acbcd", 5, 1, 5, 0},
+{"/x\?(y|z)*$/g", "ababc", 5, 1, 5, 0},
+{"/x\?(y|z)*$/g", "aaaaaaaaaaaaaaaa", 16, 1, 16, 0},
+{"/x\?(y|z)*$/g", "aaaaaaaaaaaaaaab", 16, 1, 16, 0},
+{"/x\?(y|z)*$/g", "b1a ba1", 7, 1, 7, 0},
+{"/x\?(y|z)*$/g", "12:34:56", 8, 1, 8, 0},
+{"/x\?(y|z)*$/g", "#$%", 3, 1, 3, 0},
+{"/x\?(y|z)*$/g", " \011word", 6, 1, 6, 0},
+{"/[ab]{2,3}1\?/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "content-length: 35263", 21, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "aa1aaaaaaaaa\?", 13, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "aaaaaa1aaa1x", 12, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "a11aaaaaaaaaaaax", 16, 1, 3, 3},
+{"/[ab]{2,3}1\?/g", "aaa1aa11aaa1a\?", 14, 1, 0, 4},
+{"/[ab]{2,3}1\?/g", "aaaaaaaaaaaaaaaab", 17, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "aaaaaaaaaa1ab", 13, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "", 0, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "a", 1, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "ab", 2, 1, 0, 2},
+{"/[ab]{2,3}1\?/g", "abc", 3, 1, 0, 2},
+{"/[ab]{2,3}1\?/g", "aab", 3, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "abcd", 4, 1, 0, 2},
+{"/[ab]{2,3}1\?/g", "aaab", 4, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "AAB", 3, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "xyz", 3, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "xz", 2, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "zzy", 3, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "ab ab", 5, 1, 0, 2},
+{"/[ab]{2,3}1\?/g", "acbcd", 5, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "ababc", 5, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "aaaaaaaaaaaaaaaa", 16, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "aaaaaaaaaaaaaaab", 16, 1, 0, 3},
+{"/[ab]{2,3}1\?/g", "b1a ba1", 7, 1, 4, 3},
+{"/[ab]{2,3}1\?/g", "12:34:56", 8, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", "#$%", 3, 0, 0, 0},
+{"/[ab]{2,3}1\?/g", " \011word", 6, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 86, 13},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 82, 13},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 84, 12},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 86, 13},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 81, 16},
+{"/(\\w+)@(\\w+)\\.com/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 87, 16},
+{"/(\\w+)@(\\w+)\\.com/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "content-length: 35263", 21, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 11, 14},
+{"/(\\w+)@(\\w+)\\.com/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 12, 16},
+{"/(\\w+)@(\\w+)\\.com/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 14, 14},
+{"/(\\w+)@(\\w+)\\.com/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 12, 16},
+{"/(\\w+)@(\\w+)\\.com/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 10, 16},
+{"/(\\w+)@(\\w+)\\.com/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 11, 14},
+{"/(\\w+)@(\\w+)\\.com/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "", 0, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "a", 1, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "ab", 2, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "abc", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aab", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "abcd", 4, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaab", 4, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "AAB", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "xyz", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "xz", 2, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "zzy", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "ab ab", 5, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "acbcd", 5, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "ababc", 5, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "b1a ba1", 7, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "12:34:56", 8, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", "#$%", 3, 0, 0, 0},
+{"/(\\w+)@(\\w+)\\.com/g", " \011word", 6, 0, 0, 0},
+{"/a*+a/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 0, 0, 0},
+{"/a*+a/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 0, 0, 0},
+{"/a*+a/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 0, 0, 0},
+{"/a*+a/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 0, 0, 0},
+{"/a*+a/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 0, 0, 0},
+{"/a*+a/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 0, 0, 0},
+{"/a*+a/g", "DELETE /carts/443 HTTP/1.1", 26, 0, 0, 0},
+{"/a*+a/g", "Host: www.mail.com", 18, 0, 0, 0},
+{"/a*+a/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/a*+a/g", "content-length: 35263", 21, 0, 0, 0},
+{"/a*+a/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/a*+a/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/a*+a/g", "X-Request-Id: 4cb851-ea9c", 25, 0, 0, 0},
+{"/a*+a/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 0, 0, 0},
+{"/a*+a/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 0, 0, 0},
+{"/a*+a/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 0, 0, 0},
+{"/a*+a/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 0, 0, 0},
+{"/a*+a/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 0, 0, 0},
+{"/a*+a/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 0, 0, 0},
+{"/a*+a/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/a*+a/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/a*+a/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/a*+a/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/a*+a/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/a*+a/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/a*+a/g", "", 0, 0, 0, 0},
+{"/a*+a/g", "a", 1, 0, 0, 0},
+{"/a*+a/g", "ab", 2, 0, 0, 0},
+{"/a*+a/g", "abc", 3, 0, 0, 0},
+{"/a*+a/g", "aab", 3, 0, 0, 0},
+{"/a*+a/g", "abcd", 4, 0, 0, 0},
+{"/a*+a/g", "aaab", 4, 0, 0, 0},
+{"/a*+a/g", "AAB", 3, 0, 0, 0},
+{"/a*+a/g", "xyz", 3, 0, 0, 0},
+{"/a*+a/g", "xz", 2, 0, 0, 0},
+{"/a*+a/g", "zzy", 3, 0, 0, 0},
+{"/a*+a/g", "ab ab", 5, 0, 0, 0},
+{"/a*+a/g", "acbcd", 5, 0, 0, 0},
+{"/a*+a/g", "ababc", 5, 0, 0, 0},
+{"/a*+a/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/a*+a/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/a*+a/g", "b1a ba1", 7, 0, 0, 0},
+{"/a*+a/g", "12:34:56", 8, 0, 0, 0},
+{"/a*+a/g", "#$%", 3, 0, 0, 0},
+{"/a*+a/g", " \011word", 6, 0, 0, 0},
+{"/(ab)*+c/g", "2026-02-11 16:32:41.880 INFO  [worker-7] DELETE /api/v3/reports/95753 301 4804ms user=dave@mail.com", 99, 1, 96, 1},
+{"/(ab)*+c/g", "2026-01-20 02:07:18.836 INFO  [worker-14] GET /api/v3/carts/89048 204 1722ms user=dave@corp.com", 95, 1, 54, 1},
+{"/(ab)*+c/g", "2026-06-12 12:47:32.653 INFO  [worker-10] GET /api/v3/reports/38288 204 3747ms user=bob@corp.com", 96, 1, 88, 1},
+{"/(ab)*+c/g", "2026-01-28 22:23:23.472 DEBUG [worker-2] DELETE /api/v3/reports/65333 200 3485ms user=erin@shop.com", 99, 1, 96, 1},
+{"/(ab)*+c/g", "2026-07-17 08:54:26.577 DEBUG [worker-0] POST /api/v1/items/92361 404 840ms user=mallory@shop.com", 97, 1, 94, 1},
+{"/(ab)*+c/g", "2026-08-05 15:56:14.870 INFO  [worker-14] DELETE /api/v3/reports/32899 404 3293ms user=mallory@corp.com", 103, 1, 95, 1},
+{"/(ab)*+c/g", "DELETE /carts/443 HTTP/1.1", 26, 1, 8, 1},
+{"/(ab)*+c/g", "Host: www.mail.com", 18, 1, 15, 1},
+{"/(ab)*+c/g", "Content-Length: 38584", 21, 0, 0, 0},
+{"/(ab)*+c/g", "content-length: 35263", 21, 1, 0, 1},
+{"/(ab)*+c/g", "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/90.0", 56, 0, 0, 0},
+{"/(ab)*+c/g", "Cookie: sid=10f3b2; theme=dark; lang=en", 39, 0, 0, 0},
+{"/(ab)*+c/g", "X-Request-Id: 4cb851-ea9c", 25, 1, 15, 1},
+{"/(ab)*+c/g", "68536,dave,carol@mail.com,2026-05-23,248.59,VOID", 48, 1, 11, 1},
+{"/(ab)*+c/g", "65163,trent,dave@example.com,2026-05-11,234.12,OPEN", 51, 1, 25, 1},
+{"/(ab)*+c/g", "90352,mallory,trent@corp.com,2026-08-06,495.54,VOID", 51, 1, 20, 1},
+{"/(ab)*+c/g", "62802,alice,mallory@corp.com,2026-08-12,49.24,VOID", 50, 1, 9, 1},
+{"/(ab)*+c/g", "53911,bob,dave@example.com,2026-02-01,231.74,VOID", 49, 1, 23, 1},
+{"/(ab)*+c/g", "10887,erin,trent@mail.com,2026-04-04,317.05,VOID", 48, 1, 22, 1},
+{"/(ab)*+c/g", "aa1aaaaaaaaa\?", 13, 0, 0, 0},
+{"/(ab)*+c/g", "aaaaaa1aaa1x", 12, 0, 0, 0},
+{"/(ab)*+c/g", "a11aaaaaaaaaaaax", 16, 0, 0, 0},
+{"/(ab)*+c/g", "aaa1aa11aaa1a\?", 14, 0, 0, 0},
+{"/(ab)*+c/g", "aaaaaaaaaaaaaaaab", 17, 0, 0, 0},
+{"/(ab)*+c/g", "aaaaaaaaaa1ab", 13, 0, 0, 0},
+{"/(ab)*+c/g", "", 0, 0, 0, 0},
+{"/(ab)*+c/g", "a", 1, 0, 0, 0},
+{"/(ab)*+c/g", "ab", 2, 0, 0, 0},
+{"/(ab)*+c/g", "abc", 3, 1, 0, 3},
+{"/(ab)*+c/g", "aab", 3, 0, 0, 0},
+{"/(ab)*+c/g", "abcd", 4, 1, 0, 3},
+{"/(ab)*+c/g", "aaab", 4, 0, 0, 0},
+{"/(ab)*+c/g", "AAB", 3, 0, 0, 0},
+{"/(ab)*+c/g", "xyz", 3, 0, 0, 0},
+{"/(ab)*+c/g", "xz", 2, 0, 0, 0},
+{"/(ab)*+c/g", "zzy", 3, 0, 0, 0},
+{"/(ab)*+c/g", "ab ab", 5, 0, 0, 0},
+{"/(ab)*+c/g", "acbcd", 5, 1, 1, 1},
+{"/(ab)*+c/g", "ababc", 5, 1, 0, 5},
+{"/(ab)*+c/g", "aaaaaaaaaaaaaaaa", 16, 0, 0, 0},
+{"/(ab)*+c/g", "aaaaaaaaaaaaaaab", 16, 0, 0, 0},
+{"/(ab)*+c/g", "b1a ba1", 7, 0, 0, 0},
+{"/(ab)*+c/g", "12:34:56", 8, 0, 0, 0},
+{"/(ab)*+c/g", "#$%", 3, 0, 0, 0},
+{"/(ab)*+c/g", " \011word", 6, 0, 0, 0},
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Generate bench_reference.h, expected results of harness patterns computed with Python re module.
+
+Each entry is leftmost-longest span of pattern in input, as reported by NFA, DFA and auto engines.
+Leftmost start is found with search, longest end by trying ends from the longest one,
+with lookahead which leaves exactly the rest of input, so anchors still see the whole input.
+
+Pattern is translated to Python syntax: `$` is end of input only and `.` matches any byte.
+Lazy quantifiers are not translated, library reads `+?` as `+` followed by `?`, such patterns are not listed.
+
+Usage: python3 gen_reference.py > bench_reference.h
+"""
+import random
+import re
+
+PATTERNS = [
+    # Patterns of regex_bench.c
+    r"/\d+/g",
+    r"/[A-Z]+/g",
+    r"/ERROR|WARN/g",
+    r"/\[worker-\d{1,2}\]/g",
+    r"/user=.*\.com/g",
+    r"/GET|POST|PUT|DELETE/g",
+    r"/^Content-Length: \d+/g",
+    r"/content-length: \d+/gi",
+    r"/([a-z]+)=([a-z0-9]+)/g",
+    r"/\d{4}-\d{2}-\d{2}/g",
+    r"/[a-z]+@[a-z]+\.com/g",
+    r"/,\d+\.\d{2},PAID$/g",
+    r"/(\d+,)(\w+)/g",
+    r"/\d++,/g",
+    r"/(a|aa)+b/g",
+    r"/(a*)*b/g",
+    r"/a*a*a*a*a*a*b/g",
+    r"/(\w+\d?)+x/g",
+    r"/a+b+c+/gi",
+    r"/x|y|z/gi",
+    r"/[a-z]+q*/gi",
+    r"/(get|post) \/[a-z]+/gi",
+    # Anchors, classes, ranges and groups
+    r"/^\d+$/g",
+    r"/^(GET|POST) \/\w+/g",
+    r"/\s+\S+$/g",
+    r"/[^a-z0-9 ]+/g",
+    r"/\W\w{3}\W/g",
+    r"/[0-9a-f]{6}-[0-9a-f]{4}/g",
+    r"/(\d{2}:){2}\d{2}/g",
+    r"/(ab|a)(bc|c)?/g",
+    r"/(a|b)*c|a{2,}/g",
+    r"/((a|b)c?)+d?/g",
+    r"/x?(y|z)*$/g",
+    r"/[ab]{2,3}1?/g",
+    r"/(\w+)@(\w+)\.com/g",
+    r"/a*+a/g",
+    r"/(ab)*+c/g",
+]
+
+USERS = ["alice", "bob", "carol", "dave", "erin", "mallory", "trent"]
+DOMAINS = ["example", "mail", "corp", "shop"]
+METHODS = ["GET", "POST", "PUT", "DELETE"]
+RESOURCES = ["items", "users", "orders", "carts", "reports"]
+
+
+def inputs():
+    """Inputs in format of generated corpora and short edge cases"""
+    g = random.Random(2026)
+    out = []
+    for _ in range(6):
+        out.append("2026-%02u-%02u %02u:%02u:%02u.%03u %s [worker-%u] %s /api/v%u/%s/%u %d %ums user=%s@%s.com" % (
+            g.randint(1, 12), g.randint(1, 28), g.randrange(24), g.randrange(60), g.randrange(60), g.randrange(1000),
+            g.choice(["INFO ", "WARN ", "ERROR", "DEBUG"]), g.randrange(16), g.choice(METHODS), g.randint(1, 3),
+            g.choice(RESOURCES), g.randrange(100000), g.choice([200, 201, 204, 301, 404, 500]), g.randrange(5000),
+            g.choice(USERS), g.choice(DOMAINS)))
+    out += [
+        "%s /%s/%u HTTP/1.1" % (g.choice(METHODS), g.choice(RESOURCES), g.randrange(1000)),
+        "Host: www.%s.com" % g.choice(DOMAINS),
+        "Content-Length: %u" % g.randrange(100000),
+        "content-length: %u" % g.randrange(100000),
+        "User-Agent: Mozilla/5.0 (X11; Linux x86_64) Firefox/%u.0" % g.randint(90, 129),
+        "Cookie: sid=%06x; theme=dark; lang=en" % g.randrange(1 << 24),
+        "X-Request-Id: %06x-%04x" % (g.randrange(1 << 24), g.randrange(1 << 16)),
+    ]
+    for _ in range(6):
+        out.append("%u,%s,%s@%s.com,2026-%02u-%02u,%u.%02u,%s" % (
+            g.randrange(100000), g.choice(USERS), g.choice(USERS), g.choice(DOMAINS),
+            g.randint(1, 12), g.randint(1, 28), g.randrange(500), g.randrange(100), g.choice(["PAID", "OPEN", "VOID"])))
+    for _ in range(6):
+        out.append("".join("a" if g.randrange(8) else "1" for _ in range(g.randint(10, 16))) + g.choice("!?xb"))
+    out += ["", "a", "ab", "abc", "aab", "abcd", "aaab", "AAB", "xyz", "xz", "zzy", "ab ab", "acbcd", "ababc",
+            "aaaaaaaaaaaaaaaa", "aaaaaaaaaaaaaaab", "b1a ba1", "12:34:56", "#$%", " \tword"]
+    return out
+
+
+def compile_py(pattern):
+    """Translate library pattern with flags to Python regex"""
+    body, flags = pattern[1:pattern.rindex("/")], pattern[pattern.rindex("/") + 1:]
+    out, i, cls = "", 0, False
+    while i < len(body):
+        c = body[i]
+        if c == "\\":
+            out += body[i:i + 2]
+            i += 2
+            continue
+        if cls:
+            cls = c != "]"
+        elif c == "[":
+            cls = True
+        elif c == "$":
+            c = r"\Z"
+        out += c
+        i += 1
+    return out, re.S | re.A | (re.I if "i" in flags else 0)
+
+
+def leftmost_longest(body, flags, s):
+    m = re.compile(body, flags).search(s)
+    if m is None:
+        return None
+    for e in range(len(s), m.start() - 1, -1):
+        if re.compile(r"(?:%s)(?=[\s\S]{%d}\Z)" % (body, len(s) - e), flags).match(s, m.start()):
+            return m.start(), e - m.start()
+    raise RuntimeError("no end for " + body)
+
+
+def c_str(s):
+    """C string literal, question mark is escaped against trigraphs"""
+    return '"' + "".join("\\" + c if c in '"\\?' else c if 32 <= ord(c) < 127 else "\\%03o" % ord(c) for c in s) + '"'
+
+
+def main():
+    print("/* Generated by gen_reference.py, do not edit */")
+    for pattern in PATTERNS:
+        body, flags = compile_py(pattern)
+        for s in inputs():
+            ll = leftmost_longest(body, flags, s)
+            print("{%s, %s, %d, %d, %d, %d}," % (c_str(pattern), c_str(s), len(s),
+                                                 ll is not None, ll[0] if ll else 0, ll[1] if ll else 0))
+
+
+if __name__ == "__main__":
+    main()
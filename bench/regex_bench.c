@@ -0,0 +1,741 @@
+/**
+ * \file            regex_bench.c
+ * \brief           Benchmark and regression harness for matching engines
+ */
+
+/*
+ * Copyright (c) 2017, Tilen MAJERLE
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the author nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \author          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "regex.h"
+#include "bench_corpus.h"
+
+/*
+ * Every pattern is compiled once per engine and checked on every line of every corpus:
+ *
+ *  - NFA, DFA and auto engines must report the same leftmost-longest span
+ *  - Backtracking engine with REGEX_MODE_LONGEST must report the same span
+ *  - Backtracking engine without mode must find match at the same start, it stops repetitions early
+ *  - Plain regex_match without engine memory must find match at the same start
+ *  - Search of entire corpus buffer must find the same matches with NFA, DFA and auto engines
+ *  - Pattern compiled to arena of exactly regex_compiled_size bytes must match the same as with regex_prepare
+ *  - Plain regex_match with default context must not run out of stack on repeated groups
+ *  - Stream fed in chunks of any size must report the same matches as regex_find_next loop
+ *
+ * Every engine and plain regex_match must also give results of Python re module,
+ * generated to bench_reference.h by gen_reference.py.
+ *
+ * Searches stopped by step budget or full stack are counted, but not compared.
+ * Pattern is then benchmarked on its own corpus, throughput of entire buffer search
+ * and latency percentiles of single line matches are reported per engine.
+ *
+ * Usage: regex_bench [corpus size in KiB]
+ * Exit code is 1 if any result differs.
+ */
+
+#define BENCH_P_LEN                             128     /*!< Pattern entries per compiled pattern */
+#define BENCH_C_LEN                             64      /*!< Character classes per compiled pattern */
+#define BENCH_DFA_STATES                        64      /*!< States of DFA cache */
+#define BENCH_BUDGET                            100000  /*!< Step budget of backtracking searches */
+#define BENCH_COMPILES                          1000    /*!< Number of compilations to time */
+#define BENCH_MIN_TIME                          0.02    /*!< Minimal time of throughput measurement in seconds */
+#define BENCH_REPORT_MAX                        10      /*!< Maximal number of reported differences */
+
+/**
+ * \brief           Benchmarked pattern
+ */
+typedef struct {
+    const char* pattern;                        /*!< Pattern string */
+    bench_corpus_kind_t corpus;                 /*!< Corpus to benchmark on, results are checked on all */
+} bench_pattern_t;
+
+/**
+ * \brief           Pattern compiled for single engine
+ */
+typedef struct {
+    regex_t r;                                  /*!< Compiled pattern */
+    regex_pattern_t p[BENCH_P_LEN];             /*!< Pattern entries */
+    regex_class_t c[BENCH_C_LEN];               /*!< Character classes */
+    void* mem;                                  /*!< Engine memory */
+    uint8_t ok;                                 /*!< Set to 1 if engine is available for pattern */
+} bench_engine_t;
+
+/**
+ * \brief           Single known result, for cases fixed in the past
+ */
+typedef struct {
+    const char* pattern;                        /*!< Pattern string */
+    const char* str;                            /*!< Input buffer */
+    size_t len;                                 /*!< Length of input, may include zero bytes */
+    uint8_t res;                                /*!< Expected result */
+    size_t s;                                   /*!< Expected start of leftmost-longest match */
+    size_t l;                                   /*!< Expected length of leftmost-longest match */
+} bench_case_t;
+
+/**
+ * \brief           Known result of plain \ref regex_match without engine memory, on repeated input
+ */
+typedef struct {
+    const char* pattern;                        /*!< Pattern string */
+    const char* unit;                           /*!< Repeated part of input */
+    size_t reps;                                /*!< Number of repetitions of unit */
+    const char* tail;                           /*!< Input after repeated part */
+    uint8_t res;                                /*!< Expected result */
+} bench_dflt_t;
+
+/* Pattern families of regex.c header comment, on realistic and pathological inputs */
+static const bench_pattern_t patterns[] = {
+    {"/\\d+/g", BENCH_CORPUS_LOG},
+    {"/[A-Z]+/g", BENCH_CORPUS_LOG},
+    {"/ERROR|WARN/g", BENCH_CORPUS_LOG},
+    {"/\\[worker-\\d{1,2}\\]/g", BENCH_CORPUS_LOG},
+    {"/user=.*\\.com/g", BENCH_CORPUS_LOG},
+    {"/GET|POST|PUT|DELETE/g", BENCH_CORPUS_HTTP},
+    {"/^Content-Length: \\d+/g", BENCH_CORPUS_HTTP},
+    {"/content-length: \\d+/gi", BENCH_CORPUS_HTTP},
+    {"/([a-z]+)=([a-z0-9]+)/g", BENCH_CORPUS_HTTP},
+    {"/\\d{4}-\\d{2}-\\d{2}/g", BENCH_CORPUS_CSV},
+    {"/[a-z]+@[a-z]+\\.com/g", BENCH_CORPUS_CSV},
+    {"/,\\d+\\.\\d{2},PAID$/g", BENCH_CORPUS_CSV},
+    {"/(\\d+,)(\\w+)/g", BENCH_CORPUS_CSV},
+    {"/\\d++,/g", BENCH_CORPUS_CSV},
+    {"/(a|aa)+b/g", BENCH_CORPUS_REDOS},
+    {"/(a*)*b/g", BENCH_CORPUS_REDOS},
+    {"/a*a*a*a*a*a*b/g", BENCH_CORPUS_REDOS},
+    {"/(\\w+\\d?)+x/g", BENCH_CORPUS_REDOS},
+};
+
+/* Leftmost-longest results of NFA, DFA, auto and longest backtracking searches, all within step budget */
+static const bench_case_t cases[] = {
+    {"/a+b?/g", "aab", 3, 1, 0, 3},
+    {"/[a-z]+[0-9]?/g", "abc1 de", 7, 1, 0, 4},
+    {"/a|ab/g", "ab", 2, 1, 0, 2},
+    {"/a$|b/g", "a\0", 2, 0, 0, 0},
+    {"/a$|b/g", "xa", 2, 1, 1, 1},
+    {"/x($|y)/g", "x", 1, 1, 0, 1},
+    {"/x($|y)/g", "x\0", 2, 0, 0, 0},
+    {"/(a?)++b/g", "aab", 3, 1, 0, 3},
+    {"/(a{0,2})++a/g", "aaa", 3, 0, 0, 0},
+    {"/(|b)*+c/g", "bc", 2, 1, 1, 1},
+    {"/cb{2}a?|((c|(b+ab{0,3}|c{0,3}|.)*+).)a(b|c){2,}/g", "bcabcc1", 7, 0, 0, 0},
+    {"/(a|aa)+b/g", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 40, 0, 0, 0},
+    {"/(a*)*b/g", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab", 41, 1, 0, 41},
+    {"/(a|aa)+$/g", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab", 41, 0, 0, 0},
+};
+
+/* Leftmost-longest results of Python re module, independent reference for all engines */
+static const bench_case_t ref_cases[] = {
+#include "bench_reference.h"
+};
+
+/* Repeated groups on default stack, which must grow only with choice frames and not with iterations */
+static const bench_dflt_t dflt_cases[] = {
+    {"/(ab)*c/g", "ab", 100, "", 0},
+    {"/(ab)*c/g", "ab", 100, "c", 1},
+    {"/([a-z]+ )*end/g", "word ", 36, "", 0},
+    {"/([a-z]+ )*end/g", "word ", 36, "end", 1},
+    {"/(\\d+,)+x/g", "123,", 30, "", 0},
+    {"/(\\d+,)+x/g", "123,", 30, "x", 1},
+    {"/b(ab)*/g", "ab", 100, "", 1},
+    {"/b(ab)*$/g", "ab", 100, "", 1},
+};
+
+/* Stream inputs with overlapping, empty and unfinished earlier matches */
+static const bench_case_t stream_cases[] = {
+    {"/a+/g", "xaaay", 5, 1, 1, 3},
+    {"/a*/g", "baa", 3, 1, 0, 0},
+    {"/x.*y|a/g", "xaaaa", 5, 1, 1, 1},
+    {"/x.*y|a/g", "xaaaay", 6, 1, 0, 6},
+    {"/abcd|bc|d/g", "abcabcd", 7, 1, 1, 2},
+    {"/(a|ab)(c|bcd)/g", "abcd", 4, 1, 0, 4},
+    {"/a$|b*/gi", "BbA", 3, 1, 0, 2},
+};
+
+/* Patterns with case folding, each letter may be compiled to class */
+static const char* arena_patterns[] = {
+    "/a+b+c+/gi",
+    "/x|y|z/gi",
+    "/[a-z]+q*/gi",
+    "/content-length: \\d+/gi",
+    "/(get|post) \\/[a-z]+/gi",
+};
+
+static const regex_engine_t engines[] = {REGEX_ENGINE_BACKTRACK, REGEX_ENGINE_NFA, REGEX_ENGINE_DFA, REGEX_ENGINE_AUTO};
+static const char* engine_names[] = {"backtrack", "nfa", "dfa", "auto"};
+
+#define ENGINES                                 (sizeof(engines) / sizeof(engines[0]))
+
+static bench_corpus_t corpora[BENCH_CORPUS_CNT];
+static size_t diffs;
+
+/**
+ * \brief           Get monotonic time
+ * \return          Time in units of seconds
+ */
+static double
+now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * \brief           Compare function for sorting latencies
+ */
+static int
+cmp_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * \brief           Report result which differs from reference
+ */
+static void
+report(const char* pattern, const char* what, const char* corpus, size_t line, const char* engine,
+       uint8_t res, const regex_match_t* span, const char* str, uint8_t ref, const regex_match_t* ref_span) {
+    if (++diffs > BENCH_REPORT_MAX) {
+        return;
+    }
+    printf("DIFF %s %s corpus=%s line=%lu engine=%s: res=%u [%ld,%lu], expected res=%u [%ld,%lu]\n",
+           pattern, what, corpus, (unsigned long)line, engine,
+           (unsigned)res, res == 1 ? (long)(span->s - str) : -1L, res == 1 ? (unsigned long)span->len : 0UL,
+           (unsigned)ref, ref == 1 ? (long)(ref_span->s - str) : -1L, ref == 1 ? (unsigned long)ref_span->len : 0UL);
+}
+
+/**
+ * \brief           Compile pattern for engine and give it memory
+ * \param[out]      e: Engine handle
+ * \param[in]       pattern: Pattern string
+ * \param[in]       engine: Engine to select
+ * \param[in]       max_line: Length of longest input line, for backtracking bitmap
+ * \return          1 if engine is available for pattern, 0 otherwise
+ */
+static uint8_t
+engine_init(bench_engine_t* e, const char* pattern, regex_engine_t engine, size_t max_line) {
+    size_t len;
+
+    e->ok = 0;
+    e->mem = NULL;
+    if (!regex_prepare(&e->r, pattern, e->p, BENCH_P_LEN, e->c, BENCH_C_LEN)) {
+        return 0;
+    }
+    if (engine == REGEX_ENGINE_BACKTRACK) {
+        len = regex_backtrack_mem_size(&e->r, max_line);
+    } else if (engine == REGEX_ENGINE_NFA) {
+        len = regex_nfa_mem_size(&e->r);
+    } else {
+        len = regex_dfa_mem_size(&e->r, BENCH_DFA_STATES);
+    }
+    if (!len || (e->mem = malloc(len)) == NULL) {
+        return 0;
+    }
+    if (!regex_set_engine(&e->r, engine, e->mem, len)) {
+        free(e->mem);
+        e->mem = NULL;
+        return 0;
+    }
+    regex_set_budget(&e->r.ctx, BENCH_BUDGET);
+    return e->ok = 1;
+}
+
+/**
+ * \brief           Find all matches in entire corpus buffer
+ * \param[in]       e: Engine handle
+ * \param[in]       c: Corpus
+ * \param[out]      cnt: Number of matches
+ * \param[out]      hash: Hash of all match spans
+ * \return          0 if buffer was searched to the end, \ref REGEX_EXHAUSTED or \ref REGEX_BUDGET_EXCEEDED if search stopped
+ */
+static uint8_t
+find_all(bench_engine_t* e, const bench_corpus_t* c, size_t* cnt, uint32_t* hash) {
+    regex_match_t span;
+    size_t pos = 0;
+    uint8_t res;
+
+    *cnt = 0;
+    *hash = 2166136261UL;
+    while ((res = regex_find_next(&e->r, c->buf, c->len, &pos, &span, NULL, 0)) == 1) {
+        *hash = (*hash ^ (uint32_t)(span.s - c->buf)) * 16777619UL;
+        *hash = (*hash ^ (uint32_t)span.len) * 16777619UL;
+        (*cnt)++;
+    }
+    return res;
+}
+
+/**
+ * \brief           Callback of stream search, adds match to hash
+ */
+static void
+stream_fn(void* arg, size_t start, size_t len) {
+    uint32_t* hash = arg;
+
+    hash[0] = (hash[0] ^ (uint32_t)start) * 16777619UL;
+    hash[0] = (hash[0] ^ (uint32_t)len) * 16777619UL;
+    hash[1]++;
+}
+
+/**
+ * \brief           Check that stream search of buffer fed in chunks reports the same matches as \ref regex_find_next loop
+ * \param[in]       e: Engine handle, NFA or DFA
+ * \param[in]       pattern: Pattern string
+ * \param[in]       name: Name of input for report
+ * \param[in]       str: Input buffer
+ * \param[in]       len: Length of input buffer
+ * \return          Number of checked searches
+ */
+static size_t
+check_stream(bench_engine_t* e, const char* pattern, const char* name, const char* str, size_t len) {
+    static const size_t chunks[] = {1, 2, 3, 7, 4096};
+    regex_match_t span;
+    regex_stream_t st;
+    uint32_t hash[2], ref_hash[2] = {2166136261UL, 0};
+    size_t i, n, pos = 0, cnt, checked = 0;
+    void* mem;
+
+    while (regex_find_next(&e->r, str, len, &pos, &span, NULL, 0) == 1) {
+        stream_fn(ref_hash, (size_t)(span.s - str), span.len);
+    }
+    if ((mem = malloc(regex_stream_mem_size(&e->r))) == NULL) {
+        return 0;
+    }
+    for (i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        if (!regex_stream_init(&st, &e->r, mem, regex_stream_mem_size(&e->r), stream_fn, hash)) {
+            break;
+        }
+        hash[0] = 2166136261UL;
+        hash[1] = 0;
+        for (cnt = 0, pos = 0; pos < len; pos += n) {
+            n = len - pos < chunks[i] ? len - pos : chunks[i];
+            cnt += regex_stream_feed(&st, &str[pos], n);
+        }
+        cnt += regex_stream_finish(&st);
+        if ((hash[0] != ref_hash[0] || hash[1] != ref_hash[1] || cnt != hash[1]) && ++diffs <= BENCH_REPORT_MAX) {
+            printf("DIFF %s stream input=%s chunk=%lu: %lu matches, expected %lu\n",
+                   pattern, name, (unsigned long)chunks[i], (unsigned long)hash[1], (unsigned long)ref_hash[1]);
+        }
+        checked++;
+    }
+    free(mem);
+    return checked;
+}
+
+/**
+ * \brief           Check that plain search without engine memory finds match at the same start as reference
+ * \param[in]       r: Pattern compiled without \ref regex_set_engine
+ * \param[in]       pattern: Pattern string
+ * \param[in]       corpus: Name of corpus for report
+ * \param[in]       line: Line or case number for report
+ * \param[in]       str: Input buffer
+ * \param[in]       len: Length of input buffer
+ * \param[in]       ref: Reference result
+ * \param[in]       ref_span: Reference span, used when `ref` is `1`
+ * \return          1 if result was checked, 0 if search stopped by budget or stack
+ */
+static uint8_t
+check_plain(regex_t* r, const char* pattern, const char* corpus, size_t line, const char* str, size_t len,
+            uint8_t ref, const regex_match_t* ref_span) {
+    regex_match_t span;
+    uint8_t res;
+
+    if ((res = regex_match_n(r, str, len, NULL, 0)) > 1) {
+        return 0;
+    }
+    if (res == 1 && regex_match_mode(r, str, len, 0, &span, NULL, 0) != 1) {
+        span.s = NULL;
+    }
+    if (res != ref || (res && span.s != ref_span->s)) {
+        report(pattern, "plain", corpus, line, "default", res, &span, str, ref, ref_span);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Check results of all engines on all corpora
+ * \param[in]       e: Engine handles, in order of \ref engines
+ * \param[in]       pattern: Pattern string
+ * \param[out]      stopped: Number of searches stopped by budget or stack, increased
+ * \return          Number of checked searches
+ */
+static size_t
+check_pattern(bench_engine_t* e, const char* pattern, size_t* stopped) {
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t cls[BENCH_C_LEN];
+    const bench_corpus_t* c;
+    bench_engine_t* ref_e;
+    regex_match_t span, ref_span;
+    regex_t plain;
+    size_t i, k, n, checked = 0, cnt[ENGINES];
+    uint32_t hash[ENGINES];
+    uint8_t res, ref, all;
+    const char* str;
+
+    if (!regex_prepare(&plain, pattern, p, BENCH_P_LEN, cls, BENCH_C_LEN)) {
+        return 0;
+    }
+    regex_set_budget(&plain.ctx, BENCH_BUDGET);
+
+    /* NFA is reference, auto engine falls back to longest backtracking for patterns NFA cannot run */
+    ref_e = e[1].ok ? &e[1] : &e[3];
+    for (k = 0; k < BENCH_CORPUS_CNT; k++) {
+        c = &corpora[k];
+        for (n = 0; n < c->lines; n++) {
+            str = &c->buf[c->off[n]];
+            ref = regex_match_mode(&ref_e->r, str, c->line_len[n], 0, &ref_span, NULL, 0);
+            if (ref > 1) {
+                (*stopped)++;
+                continue;
+            }
+            for (i = 0; i < ENGINES; i++) {
+                if (!e[i].ok) {
+                    continue;
+                }
+                checked++;
+                if (engines[i] == REGEX_ENGINE_BACKTRACK) {
+                    res = regex_match_mode(&e[i].r, str, c->line_len[n], REGEX_MODE_LONGEST, &span, NULL, 0);
+                    if (res <= 1 && (res != ref || (res && (span.s != ref_span.s || span.len != ref_span.len)))) {
+                        report(pattern, "longest", c->name, n, engine_names[i], res, &span, str, ref, &ref_span);
+                    }
+                    *stopped += res > 1;
+                    res = regex_match_mode(&e[i].r, str, c->line_len[n], 0, &span, NULL, 0);
+                    if (res <= 1 && (res != ref || (res && span.s != ref_span.s))) {
+                        report(pattern, "start", c->name, n, engine_names[i], res, &span, str, ref, &ref_span);
+                    }
+                } else {
+                    res = regex_match_mode(&e[i].r, str, c->line_len[n], 0, &span, NULL, 0);
+                    if (res <= 1 && (res != ref || (res && (span.s != ref_span.s || span.len != ref_span.len)))) {
+                        report(pattern, "span", c->name, n, engine_names[i], res, &span, str, ref, &ref_span);
+                    }
+                }
+                *stopped += res > 1;
+            }
+            if (check_plain(&plain, pattern, c->name, n, str, c->line_len[n], ref, &ref_span)) {
+                checked++;
+            } else {
+                (*stopped)++;
+            }
+        }
+
+        /* Search of entire buffer, with prefilters and restarts after each match */
+        for (all = 1, i = 1; i < ENGINES; i++) {
+            if (e[i].ok && find_all(&e[i], c, &cnt[i], &hash[i]) > 1) {
+                all = 0;
+            }
+        }
+        for (i = 1; all && i < ENGINES; i++) {
+            if (!e[i].ok) {
+                continue;
+            }
+            checked++;
+            if ((cnt[i] != cnt[ref_e - e] || hash[i] != hash[ref_e - e]) && ++diffs <= BENCH_REPORT_MAX) {
+                printf("DIFF %s buffer corpus=%s engine=%s: %lu matches, expected %lu\n",
+                       pattern, c->name, engine_names[i], (unsigned long)cnt[i], (unsigned long)cnt[ref_e - e]);
+            }
+        }
+        if (all && e[1].ok) {
+            checked += check_stream(&e[1], pattern, c->name, c->buf, c->len);
+        }
+        *stopped += !all;
+    }
+    return checked;
+}
+
+/**
+ * \brief           Check known results of all engines, backtracking in longest mode, and plain search
+ * \param[in]       tbl: Known results
+ * \param[in]       cnt: Number of entries in `tbl`
+ * \param[out]      stopped: Number of plain searches stopped by budget or stack, increased
+ * \return          Number of checked searches
+ */
+static size_t
+check_cases(const bench_case_t* tbl, size_t cnt, size_t* stopped) {
+    static bench_engine_t e;
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t cls[BENCH_C_LEN];
+    regex_match_t span, exp;
+    regex_t plain;
+    size_t i, k, checked = 0;
+    uint8_t res;
+
+    for (i = 0; i < cnt; i++) {
+        const bench_case_t* bc = &tbl[i];
+
+        exp.s = bc->str + bc->s;
+        exp.len = bc->l;
+        for (k = 0; k < ENGINES; k++) {
+            if (!engine_init(&e, bc->pattern, engines[k], bc->len)) {
+                continue;
+            }
+            res = regex_match_mode(&e.r, bc->str, bc->len, engines[k] == REGEX_ENGINE_BACKTRACK ? REGEX_MODE_LONGEST : 0, &span, NULL, 0);
+            if (res != bc->res || (res && (span.s != exp.s || span.len != exp.len))) {
+                report(bc->pattern, "case", "-", i, engine_names[k], res, &span, bc->str, bc->res, &exp);
+            }
+            checked++;
+            free(e.mem);
+        }
+        if (!regex_prepare(&plain, bc->pattern, p, BENCH_P_LEN, cls, BENCH_C_LEN)) {
+            continue;
+        }
+        regex_set_budget(&plain.ctx, BENCH_BUDGET);
+        if (check_plain(&plain, bc->pattern, "-", i, bc->str, bc->len, bc->res, &exp)) {
+            checked++;
+        } else {
+            (*stopped)++;
+        }
+    }
+    return checked;
+}
+
+/**
+ * \brief           Check stream search on short inputs, first match must be the expected one
+ * \return          Number of checked searches
+ */
+static size_t
+check_stream_cases(void) {
+    static bench_engine_t e;
+    regex_match_t span, exp;
+    size_t i, checked = 0;
+    uint8_t res;
+
+    for (i = 0; i < sizeof(stream_cases) / sizeof(stream_cases[0]); i++) {
+        const bench_case_t* sc = &stream_cases[i];
+
+        if (!engine_init(&e, sc->pattern, REGEX_ENGINE_NFA, sc->len)) {
+            printf("Cannot compile %s\n", sc->pattern);
+            diffs++;
+            continue;
+        }
+        exp.s = sc->str + sc->s;
+        exp.len = sc->l;
+        res = regex_match_mode(&e.r, sc->str, sc->len, 0, &span, NULL, 0);
+        if (res != sc->res || (res && (span.s != exp.s || span.len != exp.len))) {
+            report(sc->pattern, "case", "-", 0, "nfa", res, &span, sc->str, sc->res, &exp);
+        }
+        checked += 1 + check_stream(&e, sc->pattern, sc->str, sc->str, sc->len);
+        free(e.mem);
+    }
+    return checked;
+}
+
+/**
+ * \brief           Check known results of plain \ref regex_match with default context
+ * \return          Number of checked searches
+ */
+static size_t
+check_default(void) {
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t cls[BENCH_C_LEN];
+    static char str[1024];
+    regex_match_t m;
+    regex_t r;
+    size_t i, k, len;
+    uint8_t res;
+
+    for (i = 0; i < sizeof(dflt_cases) / sizeof(dflt_cases[0]); i++) {
+        const bench_dflt_t* dc = &dflt_cases[i];
+
+        for (len = 0, k = 0; k < dc->reps; k++) {
+            memcpy(&str[len], dc->unit, strlen(dc->unit));
+            len += strlen(dc->unit);
+        }
+        strcpy(&str[len], dc->tail);
+        if (!regex_prepare(&r, dc->pattern, p, BENCH_P_LEN, cls, BENCH_C_LEN)) {
+            printf("Cannot compile %s\n", dc->pattern);
+            diffs++;
+            continue;
+        }
+        if ((res = regex_match(&r, str, &m, 1)) != dc->res && ++diffs <= BENCH_REPORT_MAX) {
+            printf("DIFF %s default context on %lu bytes: res=%u, expected res=%u\n",
+                   dc->pattern, (unsigned long)strlen(str), (unsigned)res, (unsigned)dc->res);
+        }
+    }
+    return i;
+}
+
+/**
+ * \brief           Check pattern compiled to arena of exactly \ref regex_compiled_size bytes
+ * \param[in]       pattern: Pattern string
+ * \return          Number of checked matches
+ */
+static size_t
+check_arena(const char* pattern) {
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t cls[BENCH_C_LEN];
+    regex_match_t m, ref_m;
+    regex_t r, ref_r;
+    void* arena;
+    size_t k, n, size, checked = 0;
+    uint8_t res, ref;
+
+    size = regex_compiled_size(pattern);
+    if (!regex_prepare(&ref_r, pattern, p, BENCH_P_LEN, cls, BENCH_C_LEN) || size == 0 || (arena = malloc(size)) == NULL) {
+        printf("Cannot compile %s\n", pattern);
+        diffs++;
+        return 0;
+    }
+    if (!regex_prepare_arena(&r, pattern, arena, size)) {
+        if (++diffs <= BENCH_REPORT_MAX) {
+            printf("DIFF %s arena: cannot compile to %lu bytes of regex_compiled_size\n", pattern, (unsigned long)size);
+        }
+        free(arena);
+        return 0;
+    }
+    for (k = 0; k < BENCH_CORPUS_CNT; k++) {
+        const bench_corpus_t* c = &corpora[k];
+
+        for (n = 0; n < c->lines; n++) {
+            const char* str = &c->buf[c->off[n]];
+
+            res = regex_match_n(&r, str, c->line_len[n], &m, 1);
+            ref = regex_match_n(&ref_r, str, c->line_len[n], &ref_m, 1);
+            if (res != ref || (res == 1 && (m.s != ref_m.s || m.len != ref_m.len))) {
+                report(pattern, "arena", c->name, n, "backtrack", res, &m, str, ref, &ref_m);
+            }
+            checked++;
+        }
+    }
+    free(arena);
+    return checked;
+}
+
+/**
+ * \brief           Benchmark pattern on its corpus and print results
+ * \param[in]       e: Engine handles, in order of \ref engines
+ * \param[in]       bp: Pattern to benchmark
+ */
+static void
+bench_pattern(bench_engine_t* e, const bench_pattern_t* bp) {
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t cls[BENCH_C_LEN];
+    static uint8_t arena[BENCH_P_LEN * sizeof(regex_pattern_t) + BENCH_C_LEN * sizeof(regex_class_t) + 256];
+    const bench_corpus_t* c = &corpora[bp->corpus];
+    regex_match_t span;
+    regex_t r;
+    uint32_t* lat, hash;
+    double t, t_compile;
+    size_t i, n, reps, cnt, bytes;
+    uint8_t res;
+
+    /* Compilation time and bytes of compiled pattern with classes */
+    t = now();
+    for (i = 0; i < BENCH_COMPILES; i++) {
+        regex_prepare(&r, bp->pattern, p, BENCH_P_LEN, cls, BENCH_C_LEN);
+    }
+    t_compile = (now() - t) * 1e9 / BENCH_COMPILES;
+    bytes = regex_compiled_size(bp->pattern) <= sizeof(arena) ? regex_prepare_arena(&r, bp->pattern, arena, sizeof(arena)) : 0;
+
+    if ((lat = malloc(c->lines * sizeof(*lat))) == NULL) {
+        return;
+    }
+    for (i = 0; i < ENGINES; i++) {
+        printf("%-28s %-6s %9.0f %7lu %-9s", bp->pattern, c->name, t_compile, (unsigned long)bytes, engine_names[i]);
+        if (!e[i].ok) {
+            printf(" %9s\n", "n/a");
+            continue;
+        }
+
+        /* Throughput of entire buffer search */
+        t = now();
+        reps = 0;
+        do {
+            res = find_all(&e[i], c, &cnt, &hash);
+            reps++;
+        } while (res <= 1 && now() - t < BENCH_MIN_TIME && reps < 100);
+        t = now() - t;
+        if (res > 1) {
+            printf(" %9s", res == REGEX_EXHAUSTED ? "exhausted" : "budget");
+        } else {
+            printf(" %9.1f", (double)c->len * reps / t / (1024.0 * 1024.0));
+        }
+
+        /* Latency of single line matches */
+        for (n = 0; n < c->lines; n++) {
+            t = now();
+            regex_match_mode(&e[i].r, &c->buf[c->off[n]], c->line_len[n], 0, &span, NULL, 0);
+            lat[n] = (uint32_t)((now() - t) * 1e9);
+        }
+        qsort(lat, c->lines, sizeof(*lat), cmp_u32);
+        printf(" %8lu %8lu %8lu\n", (unsigned long)lat[c->lines / 2], (unsigned long)lat[c->lines * 99 / 100], (unsigned long)cnt);
+    }
+    free(lat);
+}
+
+int
+main(int argc, char** argv) {
+    static bench_engine_t e[ENGINES];
+    size_t i, k, size = 256, max_line = 0, checked, stopped = 0;
+
+    if (argc > 1 && (size = strtoul(argv[1], NULL, 10)) == 0) {
+        printf("Usage: %s [corpus size in KiB]\n", argv[0]);
+        return 2;
+    }
+    for (i = 0; i < BENCH_CORPUS_CNT; i++) {
+        if (!bench_corpus_init(&corpora[i], (bench_corpus_kind_t)i, size * 1024)) {
+            printf("Cannot allocate corpus\n");
+            return 2;
+        }
+        max_line = corpora[i].max_line > max_line ? corpora[i].max_line : max_line;
+    }
+
+    checked = check_cases(cases, sizeof(cases) / sizeof(cases[0]), &stopped);
+    checked += check_cases(ref_cases, sizeof(ref_cases) / sizeof(ref_cases[0]), &stopped);
+    checked += check_default();
+    checked += check_stream_cases();
+    for (i = 0; i < sizeof(arena_patterns) / sizeof(arena_patterns[0]); i++) {
+        checked += check_arena(arena_patterns[i]);
+    }
+    printf("%-28s %-6s %9s %7s %-9s %9s %8s %8s %8s\n", "pattern", "corpus", "comp_ns", "bytes", "engine", "MB/s", "p50_ns", "p99_ns", "matches");
+    for (i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+        for (k = 0; k < ENGINES; k++) {
+            engine_init(&e[k], patterns[i].pattern, engines[k], max_line);
+        }
+        if (!e[0].ok) {
+            printf("Cannot compile %s\n", patterns[i].pattern);
+            diffs++;
+            continue;
+        }
+        checked += check_pattern(e, patterns[i].pattern, &stopped);
+        checked += check_arena(patterns[i].pattern);
+        bench_pattern(e, &patterns[i]);
+        for (k = 0; k < ENGINES; k++) {
+            free(e[k].mem);
+        }
+    }
+    for (i = 0; i < BENCH_CORPUS_CNT; i++) {
+        bench_corpus_free(&corpora[i]);
+    }
+    printf("checked %lu results, %lu stopped by budget or stack, %lu differences\n",
+           (unsigned long)checked, (unsigned long)stopped, (unsigned long)diffs);
+    return diffs ? 1 : 0;
+}
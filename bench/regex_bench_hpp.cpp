@@ -0,0 +1,203 @@
+/**
+ * \file            regex_bench_hpp.cpp
+ * \brief           Regression harness and benchmark of compile-time patterns against C backtracking engine
+ */
+
+/*
+ * Copyright (c) 2017, Tilen MAJERLE
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *  * Neither the name of the author nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \author          Tilen MAJERLE <tilen@majerle.eu>
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "regex.hpp"
+#include "bench_corpus.h"
+
+/*
+ * Each pattern is matched on every line of every corpus with regex::static_pattern
+ * and with regex_match_n of C backtracking engine. Result and all capturing groups must be the same.
+ * Pathological patterns are left out, compile-time matcher has no step budget.
+ * Results of either engine that ran out of stack or iteration depth are not compared.
+ *
+ * Usage: regex_bench_hpp [corpus size in KiB]
+ * Exit code is 1 if any result differs.
+ */
+
+#define BENCH_P_LEN                             128     /*!< Pattern entries per compiled pattern */
+#define BENCH_C_LEN                             64      /*!< Character classes per compiled pattern */
+#define BENCH_GROUPS                            4       /*!< Number of compared capturing groups */
+#define BENCH_REPORT_MAX                        10      /*!< Maximal number of reported differences */
+
+static bench_corpus_t corpora[BENCH_CORPUS_CNT];
+static size_t diffs, checked;
+static volatile size_t found;                   /*!< Sink of timed results, so loops are not optimized away */
+
+/**
+ * \brief           Get monotonic time
+ * \return          Time in units of seconds
+ */
+static double
+now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * \brief           Check and benchmark single pattern on all corpora
+ * \tparam          P: Pattern literal
+ */
+template <regex::detail::fixed_string P>
+static void
+check_pattern() {
+    using pattern = regex::static_pattern<P>;
+    static regex_pattern_t p[BENCH_P_LEN];
+    static regex_class_t c[BENCH_C_LEN];
+    regex_match_t m[BENCH_GROUPS], ref_m[BENCH_GROUPS];
+    regex_t r;
+    double t_hpp = 0, t_c = 0, t;
+    size_t bytes = 0, cnt = 0, k, n, i, g = pattern::groups < BENCH_GROUPS ? pattern::groups : BENCH_GROUPS;
+    uint8_t ref, res;
+
+    if (!regex_prepare(&r, P.s, p, BENCH_P_LEN, c, BENCH_C_LEN)) {
+        std::printf("Cannot compile %s\n", P.s);
+        diffs++;
+        return;
+    }
+    for (k = 0; k < BENCH_CORPUS_CNT; k++) {
+        const bench_corpus_t* cp = &corpora[k];
+
+        for (n = 0; n < cp->lines; n++) {
+            const char* str = &cp->buf[cp->off[n]];
+
+            res = pattern::match_n(str, cp->line_len[n], m, BENCH_GROUPS);
+            ref = regex_match_n(&r, str, cp->line_len[n], ref_m, BENCH_GROUPS);
+            if (ref > 1 || res > 1) {
+                continue;
+            }
+            checked++;
+            for (i = 0; res == ref && res && i < g && m[i].s == ref_m[i].s && m[i].len == ref_m[i].len; i++) {}
+            if ((res != ref || (res && i < g)) && ++diffs <= BENCH_REPORT_MAX) {
+                std::printf("DIFF %s corpus=%s line=%lu: res=%u, expected res=%u, group %lu\n",
+                            P.s, cp->name, (unsigned long)n, (unsigned)res, (unsigned)ref, (unsigned long)i);
+            }
+        }
+
+        /* Throughput of single line matches with groups */
+        t = now();
+        for (n = 0; n < cp->lines; n++) {
+            cnt += pattern::match(&cp->buf[cp->off[n]], cp->line_len[n], m, BENCH_GROUPS) + m[0].len;
+        }
+        t_hpp += now() - t;
+        t = now();
+        for (n = 0; n < cp->lines; n++) {
+            cnt += regex_match_n(&r, &cp->buf[cp->off[n]], cp->line_len[n], ref_m, BENCH_GROUPS) + ref_m[0].len;
+        }
+        t_c += now() - t;
+        bytes += cp->len;
+    }
+    found = found + cnt;
+    std::printf("%-28s %9.1f %9.1f\n", P.s, bytes / t_hpp / (1024.0 * 1024.0), bytes / t_c / (1024.0 * 1024.0));
+}
+
+/**
+ * \brief           Check that iterations of repeated group beyond \ref REGEX_CFG_HPP_LOOP_DEPTH stop match cleanly
+ * \param[in]       reps: Number of `ab` units before final `c`
+ * \param[in]       exp: Expected result of match_n
+ */
+static void
+check_depth(size_t reps, uint8_t exp) {
+    using pattern = regex::static_pattern<"/(ab)*c/g">;
+    char* str = static_cast<char*>(std::malloc(2 * reps + 1));
+    regex_match_t m[1];
+    uint8_t res;
+    size_t i;
+
+    if (str == nullptr) {
+        diffs++;
+        return;
+    }
+    for (i = 0; i < reps; i++) {
+        std::memcpy(&str[2 * i], "ab", 2);
+    }
+    str[2 * reps] = 'c';
+    checked++;
+    res = pattern::match_n(str, 2 * reps + 1, m, 1);
+    if (res != exp || (res == 1 && (m[0].s != &str[2 * reps - 2] || m[0].len != 2))
+        || (res != 1 && pattern::match(str, 2 * reps + 1))) {
+        diffs++;
+        std::printf("DIFF depth reps=%lu: res=%u, expected res=%u\n", (unsigned long)reps, (unsigned)res, (unsigned)exp);
+    }
+    std::free(str);
+}
+
+int
+main(int argc, char** argv) {
+    size_t i, size = 256;
+
+    if (argc > 1 && (size = std::strtoul(argv[1], nullptr, 10)) == 0) {
+        std::printf("Usage: %s [corpus size in KiB]\n", argv[0]);
+        return 2;
+    }
+    for (i = 0; i < BENCH_CORPUS_CNT; i++) {
+        if (!bench_corpus_init(&corpora[i], (bench_corpus_kind_t)i, size * 1024)) {
+            std::printf("Cannot allocate corpus\n");
+            return 2;
+        }
+    }
+
+    std::printf("%-28s %9s %9s\n", "pattern", "hpp MB/s", "C MB/s");
+    check_pattern<"/\\d+/g">();
+    check_pattern<"/[A-Z]+/g">();
+    check_pattern<"/ERROR|WARN/g">();
+    check_pattern<"/\\[worker-\\d{1,2}\\]/g">();
+    check_pattern<"/user=.*\\.com/g">();
+    check_pattern<"/GET|POST|PUT|DELETE/g">();
+    check_pattern<"/^Content-Length: \\d+/g">();
+    check_pattern<"/content-length: \\d+/gi">();
+    check_pattern<"/([a-z]+)=([a-z0-9]+)/g">();
+    check_pattern<"/\\d{4}-\\d{2}-\\d{2}/g">();
+    check_pattern<"/[a-z]+@[a-z]+\\.com/g">();
+    check_pattern<"/,\\d+\\.\\d{2},PAID$/g">();
+    check_pattern<"/(\\d+,)(\\w+)/g">();
+    check_pattern<"/\\d++,/g">();
+    check_pattern<"/(a|b$)+/g">();
+    check_pattern<"/(((a)|b)++x|ab)/g">();
+    check_pattern<"/x(a$|1)?/g">();
+    check_pattern<"/a?a?a?a?a?a?a?a?b/g">();
+    check_pattern<"/(a?)++b/g">();
+    check_pattern<"/(a{0,2})++a/g">();
+    check_pattern<"/([a-z]+\\d?|.)*+\\d/g">();
+
+    check_depth(REGEX_CFG_HPP_LOOP_DEPTH - 1, 1);
+    check_depth(1024 * 1024, REGEX_EXHAUSTED);
+
+    for (i = 0; i < BENCH_CORPUS_CNT; i++) {
+        bench_corpus_free(&corpora[i]);
+    }
+    std::printf("checked %lu results, %lu differences\n", (unsigned long)checked, (unsigned long)diffs);
+    return diffs ? 1 : 0;
+}